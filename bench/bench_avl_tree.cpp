@@ -0,0 +1,41 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "tree/avl_tree.hpp"
+
+// Usage: bench_avl_tree [N...]   (defaults: N = 2^14 .. 2^20)
+// Inserts N random keys, finds them all, then removes them all; with O(log n) updates ns/op grows with log2(N), not N
+int main(int argc, char** argv) {
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; i++) sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty()) for (size_t n = size_t{1} << 14; n <= size_t{1} << 20; n *= 4) sizes.push_back(n);
+    std::mt19937 gen(42);
+    std::cout << std::setw(10) << "N" << std::setw(8) << "log2N" << std::setw(8) << "height" << std::setw(16) << "insert(ns/op)"
+              << std::setw(14) << "find(ns/op)" << std::setw(16) << "remove(ns/op)" << std::endl;
+    for (size_t n : sizes) {
+        std::vector<int> keys(n);
+        for (size_t i = 0; i < n; i++) keys[i] = static_cast<int>(i);
+        std::shuffle(keys.begin(), keys.end(), gen);
+        AVLTree<int> tree;
+        auto start = std::chrono::steady_clock::now();
+        for (int key : keys) tree.insert(key);
+        double insertNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+        const int height = tree.getHeight(tree.getRootNode().value());
+        std::shuffle(keys.begin(), keys.end(), gen);
+        size_t found = 0;
+        start = std::chrono::steady_clock::now();
+        for (int key : keys) found += tree.find(key).has_value();
+        double findNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+        std::shuffle(keys.begin(), keys.end(), gen);
+        start = std::chrono::steady_clock::now();
+        for (int key : keys) tree.remove(key);
+        double removeNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+        std::cout << std::setw(10) << n << std::setw(8) << std::fixed << std::setprecision(1) << std::log2(static_cast<double>(n)) << std::setw(8) << height
+                  << std::setw(16) << insertNs << std::setw(14) << findNs << std::setw(16) << removeNs << (found == n && tree.isEmpty() ? "" : "  MISMATCH") << std::endl;
+    }
+}
@@ -0,0 +1,41 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include "graph/adjacency_matrix_graph.hpp"
+
+// Usage: bench_floyd [threads] [V...]   (defaults: hardware threads, V = 1024 2048 4096 8192)
+int main(int argc, char** argv) {
+    size_t threadCount = argc > 1 ? std::stoul(argv[1]) : std::thread::hardware_concurrency();
+    std::vector<size_t> sizes;
+    for (int i = 2; i < argc; i++) sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty()) sizes = {1024, 2048, 4096, 8192};
+    ThreadPool pool(threadCount);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    std::uniform_int_distribution<int> weight(1, 100);
+    std::cout << std::setw(8) << "V" << std::setw(16) << "floyd(ms)" << std::setw(20) << "floydBlocked(ms)" << std::setw(12) << "speedup" << std::setw(10) << "match" << std::endl;
+    for (size_t vertexCount : sizes) {
+        AdjacencyMatrixGraph<int, int> graph;
+        for (size_t i = 0; i < vertexCount; i++) graph.addVertex(static_cast<int>(i));
+        for (size_t i = 0; i < vertexCount; i++) {
+            for (size_t j = 0; j < vertexCount; j++) {
+                if (i != j && coin(gen) < 0.05) graph.addEdgeByIndex(i, j, weight(gen));
+            }
+        }
+        auto start = std::chrono::steady_clock::now();
+        auto legacy = graph.floyd();
+        double legacyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        start = std::chrono::steady_clock::now();
+        auto blocked = graph.floydBlocked(pool);
+        double blockedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        bool match = legacy.has_value() && blocked.has_value();
+        for (size_t i = 0; match && i < vertexCount; i++) {
+            for (size_t j = 0; j < vertexCount; j++) if ((*legacy)[i][j] != (*blocked)[i * vertexCount + j]) match = false;
+        }
+        std::cout << std::setw(8) << vertexCount << std::setw(16) << std::fixed << std::setprecision(1) << legacyMs << std::setw(20) << blockedMs
+                  << std::setw(11) << std::setprecision(2) << legacyMs / blockedMs << "x" << std::setw(10) << (match ? "yes" : "NO") << std::endl;
+    }
+}
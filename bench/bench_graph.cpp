@@ -0,0 +1,94 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <functional>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+#include "graph/adjacency_matrix_graph.hpp"
+#include "graph/graph_generators.hpp"
+
+using Graph = AdjacencyMatrixGraph<size_t, int>;
+
+static long peakRssKb() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+    return static_cast<long>(counters.PeakWorkingSetSize / 1024);
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#endif
+}
+
+static Graph build(const EdgeList<size_t, int>& list, Graph::GraphType type) { return Graph(list.vertices, list.edges, type); }
+
+// Adds a random spanning tree so the MST benchmarks see a connected graph instead of bailing out early
+static EdgeList<size_t, int> connected(EdgeList<size_t, int> list, uint64_t seed) {
+    RandomEngine gen(seed);
+    for (size_t i = 1; i < list.vertices.size(); i++) list.edges.push_back({std::uniform_int_distribution<size_t>(0, i - 1)(gen), i, randomWeight(gen, 1, 100)});
+    return list;
+}
+
+static bool first = true;
+
+// Throughput is edges per second, except for cubic algorithms whose work does not depend on the edges: those report V^3 per second
+static void report(const std::string& algorithm, const std::string& workload, const Graph& graph, const std::function<bool()>& run, bool cubic = false) {
+    auto start = std::chrono::steady_clock::now();
+    bool ok = run();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    size_t vertexCount = graph.getVertexCount().value_or(0);
+    size_t edgeCount = graph.getEdgeCount().value_or(0);
+    double work = cubic ? static_cast<double>(vertexCount) * vertexCount * vertexCount : static_cast<double>(edgeCount);
+    std::cout << (first ? "  " : ",\n  ") << "{\"algorithm\": \"" << algorithm << "\", \"workload\": \"" << workload << "\", \"vertices\": " << vertexCount
+              << ", \"edges\": " << edgeCount << ", \"ok\": " << (ok ? "true" : "false") << ", \"ms\": " << seconds * 1000
+              << (cubic ? ", \"verticesCubedPerSecond\": " : ", \"edgesPerSecond\": ") << (seconds > 0 ? work / seconds : 0) << ", \"peakRssKb\": " << peakRssKb() << "}";
+    first = false;
+}
+
+// Usage: bench_graph [seed] [V...]   (defaults: seed 42, V = 256 512 1024 2048; Floyd only runs up to V = 1024)
+// Prints one JSON array with a record per (algorithm, workload, V)
+int main(int argc, char** argv) {
+    uint64_t seed = argc > 1 ? std::stoull(argv[1]) : 42;
+    std::vector<size_t> sizes;
+    for (int i = 2; i < argc; i++) sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty()) sizes = {256, 512, 1024, 2048};
+    std::cout << "[\n";
+    for (size_t vertexCount : sizes) {
+        const double probability = 8.0 / static_cast<double>(vertexCount);
+        const Graph directed = build(erdosRenyiGraph<int>(vertexCount, probability, true, seed, 1, 100).value(), Graph::GraphType::Directed);
+        const Graph undirected = build(connected(erdosRenyiGraph<int>(vertexCount, probability, false, seed + 1, 1, 100).value(), seed + 5), Graph::GraphType::Undirected);
+        size_t side = 1;
+        while ((side + 1) * (side + 1) <= vertexCount) side++;
+        const Graph grid = build(gridGraph<int>(side, side, seed + 2, 1.0, 1, 100).value(), Graph::GraphType::Undirected);
+        const Graph dag = build(layeredDAG<int>(vertexCount, 16, 4, seed + 3, 1, 100).value(), Graph::GraphType::Directed);
+        size_t scale = 0;
+        while ((size_t{2} << scale) <= vertexCount) scale++;
+        const Graph rmat = build(rmatGraph<int>(scale, 8, seed + 4, 0.57, 0.19, 0.19, 1, 100).value(), Graph::GraphType::Directed);
+        auto none = [](size_t) {};
+        for (const auto& [name, graph] : {std::pair<const char*, const Graph*>{"erdos-renyi", &directed}, {"rmat", &rmat}, {"grid", &grid}}) {
+            report("BFS", name, *graph, [&] { return graph->BFS(0, none).has_value(); });
+            report("DFS", name, *graph, [&] { return graph->DFSIterative(0, none).has_value(); });
+        }
+        for (const auto& [name, graph] : {std::pair<const char*, const Graph*>{"erdos-renyi", &directed}, {"rmat", &rmat}}) {
+            report("Dijkstra", name, *graph, [&] { return graph->Dijkstra(0).has_value(); });
+            report("hasCycle", name, *graph, [&] { return graph->hasCycle().has_value(); });
+            if (vertexCount <= 1024) report("Floyd", name, *graph, [&] { return graph->floyd().has_value(); }, true);
+        }
+        for (const auto& [name, graph] : {std::pair<const char*, const Graph*>{"erdos-renyi", &undirected}, {"grid", &grid}}) {
+            report("Prim", name, *graph, [&] { return graph->primMST(0).has_value(); });
+            report("Kruskal", name, *graph, [&] { return graph->kruskalMST().has_value(); });
+        }
+        report("topologicalSort", "layered-dag", dag, [&] { return dag.topologicalSort().has_value(); });
+        report("hasCycle", "layered-dag", dag, [&] { return dag.hasCycle().has_value(); });
+    }
+    std::cout << "\n]" << std::endl;
+}
@@ -0,0 +1,42 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include "set/union_find_set.hpp"
+#include "set/concurrent_union_find_set.hpp"
+
+// Usage: bench_union_find [elements] [edges] [threads...]   (defaults: 2^24 elements, 2^26 edges, 1 2 4 ... hardware threads)
+// Unites one random edge stream with DenseUnionFindSet and with ConcurrentUnionFindSet on growing pools
+int main(int argc, char** argv) {
+    size_t elementCount = argc > 1 ? std::stoull(argv[1]) : size_t{1} << 24;
+    size_t edgeCount = argc > 2 ? std::stoull(argv[2]) : size_t{1} << 26;
+    std::vector<size_t> threadCounts;
+    for (int i = 3; i < argc; i++) threadCounts.push_back(std::stoul(argv[i]));
+    if (threadCounts.empty()) {
+        for (size_t t = 1; t < std::thread::hardware_concurrency(); t *= 2) threadCounts.push_back(t);
+        threadCounts.push_back(std::thread::hardware_concurrency());
+    }
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<size_t> element(0, elementCount - 1);
+    std::vector<std::pair<size_t, size_t>> edges(edgeCount);
+    for (auto& edge : edges) edge = {element(gen), element(gen)};
+    auto start = std::chrono::steady_clock::now();
+    DenseUnionFindSet sequential(elementCount);
+    size_t expected = sequential.unite(edges);
+    double sequentialMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::setw(10) << "threads" << std::setw(14) << "ms" << std::setw(18) << "Medges/s" << std::setw(12) << "speedup" << std::setw(10) << "match" << std::endl;
+    std::cout << std::setw(10) << "dense" << std::setw(14) << std::fixed << std::setprecision(1) << sequentialMs << std::setw(18) << edgeCount / sequentialMs / 1000
+              << std::setw(12) << "-" << std::setw(10) << "-" << std::endl;
+    for (size_t threadCount : threadCounts) {
+        ThreadPool pool(threadCount);
+        ConcurrentUnionFindSet concurrent(elementCount);
+        start = std::chrono::steady_clock::now();
+        size_t merges = concurrent.unite(edges, pool);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        bool match = merges == expected && concurrent.getSetCount() == sequential.getSetCount();
+        std::cout << std::setw(10) << threadCount << std::setw(14) << ms << std::setw(18) << edgeCount / ms / 1000
+                  << std::setw(11) << std::setprecision(2) << sequentialMs / ms << "x" << std::setw(10) << (match ? "yes" : "NO") << std::setprecision(1) << std::endl;
+    }
+}
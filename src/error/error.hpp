@@ -20,6 +20,8 @@ enum class DataStructureError {
     InvalidRange,
     InvalidSampleSize,
     RandomGenerationFailed,
+    FileOperationFailed,
+    InvalidFileFormat,
 };
 
 std::string error_message(DataStructureError error) {
@@ -36,6 +38,8 @@ std::string error_message(DataStructureError error) {
         case DataStructureError::InvalidRange: return "Invalid range";
         case DataStructureError::InvalidSampleSize: return "Invalid sample size";
         case DataStructureError::RandomGenerationFailed: return "Random generation failed";
+        case DataStructureError::FileOperationFailed: return "File operation failed";
+        case DataStructureError::InvalidFileFormat: return "Invalid file format";
         default: return "Unknown error";
     }
 }
\ No newline at end of file
@@ -7,10 +7,30 @@
 #include <numeric>
 #include <optional>
 #include <algorithm>
+#include <unordered_map>
+#include <map>
+#include <cmath>
+#include <atomic>
+#include <limits>
+#include <type_traits>
+#include "edge_matrix.hpp"
 #include "../set/union_find_set.hpp"
+#include "../set/concurrent_union_find_set.hpp"
+#include "../set/bit_set.hpp"
+#include "../thread/thread_pool.hpp"
 #include "../error/error.hpp"
+
+template<typename V, typename E>
+class CSRGraph;
+
+template<typename V, typename E>
+struct CSRView;
+
 template<typename V, typename E>
 class AdjacencyMatrixGraph {
+    friend class CSRGraph<V, E>;
+    friend struct CSRView<V, E>;
+
 public:
     enum class GraphType {
         Directed,
@@ -18,7 +38,7 @@ public:
     };
     struct Graph {
         std::vector<V> vertices;
-        std::vector<std::vector<E>> edges;
+        EdgeMatrix<E> edges;
         GraphType graphType;
     };
     struct Edge {
@@ -26,34 +46,777 @@ public:
         size_t end;
         E weight;
     };
+    enum class PathSearchMode {
+        Dijkstra,
+        Bidirectional,
+        AStar
+    };
+    struct ShortestPath {
+        E distance;
+        std::vector<V> path;
+    };
+    enum class VertexOrdering {
+        ReverseCuthillMcKee,
+        DegreeDescending,
+        BreadthFirst
+    };
+    struct LocalityStats {
+        size_t bandwidth;       // largest |i - j| over the edges
+        size_t profile;         // sum over rows of i - (lowest neighbour index below i)
+        double averageGap;      // mean |i - j| over the edges
+        size_t occupiedWords;   // non-zero 64-column presence words, the blocks a neighbour walk actually visits
+    };
+    struct Reordering {
+        std::vector<size_t> previousIndex;   // previousIndex[i] is the index vertex i had before the reordering
+        LocalityStats before;
+        LocalityStats after;
+    };
+
+    // Per-thread buffers for s-t queries; vertex stamps make reuse O(1) instead of clearing V entries per query
+    class ShortestPathScratch {
+        friend class AdjacencyMatrixGraph;
+        friend class CSRGraph<V, E>;
+        friend struct CSRView<V, E>;
+
+        struct Frontier {
+            std::vector<E> distance;
+            std::vector<E> key;
+            std::vector<size_t> predecessor;
+            std::vector<uint32_t> reached;
+            std::vector<uint32_t> settled;
+            std::vector<size_t> heap;
+            std::vector<size_t> heapPosition;
+
+            void prepare(size_t vertexCount) {
+                heap.clear();
+                if (distance.size() >= vertexCount) return;
+                distance.resize(vertexCount);
+                key.resize(vertexCount);
+                predecessor.resize(vertexCount);
+                reached.resize(vertexCount, 0);
+                settled.resize(vertexCount, 0);
+                heapPosition.resize(vertexCount);
+            }
+
+            void siftUp(size_t position) {
+                size_t vertex = heap[position];
+                while (position > 0) {
+                    size_t parent = (position - 1) / 2;
+                    if (!(key[vertex] < key[heap[parent]])) break;
+                    heap[position] = heap[parent];
+                    heapPosition[heap[position]] = position;
+                    position = parent;
+                }
+                heap[position] = vertex;
+                heapPosition[vertex] = position;
+            }
+
+            void siftDown(size_t position) {
+                size_t vertex = heap[position];
+                while (true) {
+                    size_t child = position * 2 + 1;
+                    if (child >= heap.size()) break;
+                    if (child + 1 < heap.size() && key[heap[child + 1]] < key[heap[child]]) child++;
+                    if (!(key[heap[child]] < key[vertex])) break;
+                    heap[position] = heap[child];
+                    heapPosition[heap[position]] = position;
+                    position = child;
+                }
+                heap[position] = vertex;
+                heapPosition[vertex] = position;
+            }
+
+            // Queues vertex, or lowers its key in place when it is already queued
+            void push(size_t vertex, E newKey, bool queued) {
+                key[vertex] = newKey;
+                if (!queued) {
+                    heapPosition[vertex] = heap.size();
+                    heap.push_back(vertex);
+                }
+                siftUp(heapPosition[vertex]);
+            }
+
+            size_t pop() {
+                size_t top = heap[0];
+                heap[0] = heap.back();
+                heap.pop_back();
+                if (!heap.empty()) siftDown(0);
+                return top;
+            }
+        };
+
+        Frontier forward;
+        Frontier backward;
+        uint32_t generation = 0;
+
+        void prepare(size_t vertexCount) {
+            forward.prepare(vertexCount);
+            backward.prepare(vertexCount);
+            if (++generation != 0) return;
+            for (Frontier* frontier : {&forward, &backward}) {
+                std::fill(frontier->reached.begin(), frontier->reached.end(), 0);
+                std::fill(frontier->settled.begin(), frontier->settled.end(), 0);
+            }
+            generation = 1;
+        }
+    };
 
 protected:
+    // Pearce-Kelly dynamic topological order, maintained by addEdge while enabled
+    struct TopologicalOrder {
+        bool enabled = false;
+        std::vector<size_t> position;
+        std::vector<size_t> vertexAt;
+        BitSet visited = BitSet(0);
+        std::vector<size_t> forward;
+        std::vector<size_t> backward;
+        std::vector<size_t> pending;
+        std::vector<size_t> slots;
+    };
+
+    // Transitive closure, one bit row per vertex; every mutation invalidates it until the next buildReachabilityIndex
+    struct ReachabilityIndex {
+        std::vector<uint64_t, AlignedAllocator<uint64_t>> bits;
+        size_t rowWords = 0;
+        bool valid = false;
+    };
+
+    // Undirected components as a union-find over vertex indices (union by size), merged by addEdge while enabled and
+    // split by removeEdge only when the removed edge was a bridge. Stamps mark the two searches of that bridge check
+    struct ConnectivityIndex {
+        bool enabled = false;
+        DenseUnionFindSet components = DenseUnionFindSet(0);
+        std::vector<uint32_t> stamp;
+        uint32_t generation = 0;
+    };
+
     Graph graph;
+    std::unordered_map<V, size_t> vertexIndex;
+    TopologicalOrder topologicalOrder;
+    ReachabilityIndex reachability;
+    ConnectivityIndex connectivity;
 
     std::expected<size_t, DataStructureError> findVertexIndex(V vertex) const {
-        for (size_t i = 0; i < graph.vertices.size(); i++) if (graph.vertices[i] == vertex) return i;
-        return std::unexpected(DataStructureError::ElementNotFound);
+        auto it = vertexIndex.find(vertex);
+        if (it == vertexIndex.end()) return std::unexpected(DataStructureError::ElementNotFound);
+        return it->second;
+    }
+
+    bool isValidIndex(size_t index) const { return index < graph.vertices.size(); }
+
+    // Bulk loaders: keeps the first occurrence of every vertex in unique, fills index, and returns where each position of
+    // vertices ended up, so edges given by position can be remapped onto the deduplicated table
+    static std::vector<size_t> deduplicateVertices(std::vector<V>& vertices, std::vector<V>& unique, std::unordered_map<V, size_t>& index) {
+        std::vector<size_t> position(vertices.size());
+        unique.clear();
+        unique.reserve(vertices.size());
+        index.clear();
+        index.reserve(vertices.size());
+        for (size_t i = 0; i < vertices.size(); i++) {
+            auto [it, inserted] = index.try_emplace(vertices[i], unique.size());
+            if (inserted) unique.push_back(std::move(vertices[i]));
+            position[i] = it->second;
+        }
+        return position;
+    }
+
+    template<typename F>
+    void forEachNeighbour(size_t index, F&& visit) const {
+        graph.edges.forEachNeighbour(index, std::forward<F>(visit));
+    }
+
+    // Visits in the order of the recursive formulation, but the call stack lives in frames of (vertex, next column to scan)
+    void DFSRecursiveFrom(size_t startIndex, BitSet& visited, std::vector<size_t>& order) const {
+        const size_t vertexCount = graph.vertices.size();
+        std::vector<std::pair<size_t, size_t>> frames;
+        auto enter = [&](size_t index) {
+            visited.set(index);
+            order.push_back(index);
+            frames.push_back({index, 0});
+        };
+        enter(startIndex);
+        while (!frames.empty()) {
+            auto& [index, cursor] = frames.back();
+            const size_t next = graph.edges.nextNeighbour(index, cursor);
+            if (next == vertexCount) {
+                frames.pop_back();
+                continue;
+            }
+            cursor = next + 1;
+            if (!visited.test(next)) enter(next);
+        }
+    }
+
+    // Beamer's switching thresholds, with frontier/unvisited vertex counts standing in for edge counts since every matrix row costs V to scan
+    static constexpr size_t BottomUpAlpha = 14;
+    static constexpr size_t TopDownBeta = 24;
+
+    // Level-synchronous BFS; when ordered, every level is sorted by (position of earliest frontier parent, index), which is exactly the order BFSByIndex produces
+    std::vector<size_t> parallelBFS(size_t startIndex, ThreadPool& pool, bool ordered, size_t stopIndex) const {
+        const size_t vertexCount = graph.vertices.size();
+        std::vector<size_t> order{startIndex};
+        std::vector<size_t> parentPosition(vertexCount, vertexCount);
+        std::vector<size_t> frontierPosition(vertexCount, vertexCount);
+        std::vector<std::vector<size_t>> discovered(pool.getThreadCount());
+        BitSet visited(vertexCount);
+        BitSet claimed(vertexCount);
+        visited.set(startIndex);
+        size_t levelBegin = 0;
+        size_t unvisitedCount = vertexCount - 1;
+        bool bottomUp = false;
+        while (levelBegin < order.size() && !(stopIndex < vertexCount && visited.test(stopIndex))) {
+            const size_t levelEnd = order.size();
+            const size_t frontierSize = levelEnd - levelBegin;
+            if (!bottomUp && frontierSize * BottomUpAlpha > unvisitedCount) bottomUp = true;
+            else if (bottomUp && frontierSize * TopDownBeta < vertexCount) bottomUp = false;
+            if (!bottomUp) {
+                pool.parallelFor(levelBegin, levelEnd, [&](size_t begin, size_t end, size_t worker) {
+                    for (size_t position = begin; position < end; position++) {
+                        forEachNeighbour(order[position], [&](size_t neighbour) {
+                            if (visited.test(neighbour)) return;
+                            if (ordered) {
+                                std::atomic_ref<size_t> parent(parentPosition[neighbour]);
+                                size_t current = parent.load(std::memory_order_relaxed);
+                                while (position < current && !parent.compare_exchange_weak(current, position, std::memory_order_relaxed)) {}
+                            }
+                            if (claimed.atomicTestAndSet(neighbour)) discovered[worker].push_back(neighbour);
+                        });
+                    }
+                });
+            }
+            else {
+                for (size_t position = levelBegin; position < levelEnd; position++) frontierPosition[order[position]] = position;
+                const bool symmetric = graph.graphType == GraphType::Undirected;
+                pool.parallelFor(0, vertexCount, [&](size_t begin, size_t end, size_t worker) {
+                    for (size_t vertex = begin; vertex < end; vertex++) {
+                        if (visited.test(vertex)) continue;
+                        size_t best = vertexCount;
+                        for (size_t parent = 0; parent < vertexCount; parent++) {
+                            if (frontierPosition[parent] >= best) continue;
+                            if (!(symmetric ? graph.edges.hasEdge(vertex, parent) : graph.edges.hasEdge(parent, vertex))) continue;
+                            best = frontierPosition[parent];
+                            if (!ordered) break;
+                        }
+                        if (best == vertexCount) continue;
+                        parentPosition[vertex] = best;
+                        discovered[worker].push_back(vertex);
+                    }
+                });
+                for (size_t position = levelBegin; position < levelEnd; position++) frontierPosition[order[position]] = vertexCount;
+            }
+            for (auto& local : discovered) {
+                order.insert(order.end(), local.begin(), local.end());
+                local.clear();
+            }
+            if (ordered) {
+                std::sort(order.begin() + levelEnd, order.end(), [&parentPosition](size_t a, size_t b) {
+                    return parentPosition[a] != parentPosition[b] ? parentPosition[a] < parentPosition[b] : a < b;
+                });
+            }
+            for (size_t position = levelEnd; position < order.size(); position++) {
+                visited.set(order[position]);
+                claimed.reset(order[position]);
+            }
+            unvisitedCount -= order.size() - levelEnd;
+            levelBegin = levelEnd;
+        }
+        return order;
+    }
+
+    // Meyer and Sanders: delta around maxWeight / averageDegree keeps buckets small without many re-relaxations
+    std::expected<E, DataStructureError> chooseDelta() const {
+        E maxWeight = 0;
+        size_t edgeCount = 0;
+        for (size_t i = 0; i < graph.vertices.size(); i++) {
+            bool negative = false;
+            forEachNeighbour(i, [&](size_t j) {
+                E weight = graph.edges.weight(i, j);
+                if constexpr (std::is_signed_v<E>) negative |= weight < 0;
+                maxWeight = std::max(maxWeight, weight);
+                edgeCount++;
+            });
+            if (negative) return std::unexpected(DataStructureError::InvalidArgument);
+        }
+        size_t averageDegree = std::max<size_t>(1, edgeCount / graph.vertices.size());
+        E delta = maxWeight / static_cast<E>(averageDegree);
+        if (!(delta > 0)) delta = std::is_integral_v<E> ? E{1} : std::max(maxWeight, std::numeric_limits<E>::min());
+        return delta;
+    }
+
+    static constexpr size_t MultiSourceBatch = 512;
+
+    // MS-BFS (Then et al.): each vertex carries one bit per source for seen / current frontier / next frontier, so a
+    // single pass over a frontier vertex's row advances every search that reached it in the same level
+    void multiSourceBatch(const std::vector<size_t>& sources, size_t first, size_t last, std::vector<std::vector<size_t>>& distances, ThreadPool& pool) const {
+        const size_t vertexCount = graph.vertices.size();
+        const size_t laneWords = (last - first + BitSet::WordBits - 1) / BitSet::WordBits;
+        std::vector<uint64_t> seen(vertexCount * laneWords, 0);
+        std::vector<uint64_t> visit(vertexCount * laneWords, 0);
+        std::vector<uint64_t> next(vertexCount * laneWords, 0);
+        std::vector<size_t> frontier;
+        std::vector<std::vector<size_t>> discovered(pool.getThreadCount());
+        for (size_t lane = 0; lane < last - first; lane++) {
+            const size_t source = sources[first + lane];
+            const uint64_t bit = uint64_t{1} << (lane % BitSet::WordBits);
+            frontier.push_back(source);
+            seen[source * laneWords + lane / BitSet::WordBits] |= bit;
+            visit[source * laneWords + lane / BitSet::WordBits] |= bit;
+            distances[first + lane][source] = 0;
+        }
+        std::sort(frontier.begin(), frontier.end());
+        frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+        for (size_t level = 1; !frontier.empty(); level++) {
+            pool.parallelFor(0, frontier.size(), [&](size_t begin, size_t end, size_t) {
+                for (size_t k = begin; k < end; k++) {
+                    const uint64_t* from = visit.data() + frontier[k] * laneWords;
+                    forEachNeighbour(frontier[k], [&](size_t neighbour) {
+                        for (size_t w = 0; w < laneWords; w++) {
+                            std::atomic_ref<uint64_t> target(next[neighbour * laneWords + w]);
+                            const uint64_t fresh = from[w] & ~seen[neighbour * laneWords + w];
+                            if (fresh & ~target.load(std::memory_order_relaxed)) target.fetch_or(fresh, std::memory_order_relaxed);
+                        }
+                    });
+                }
+            });
+            for (size_t vertex : frontier) std::fill_n(visit.begin() + vertex * laneWords, laneWords, 0);
+            pool.parallelFor(0, vertexCount, [&](size_t begin, size_t end, size_t worker) {
+                for (size_t vertex = begin; vertex < end; vertex++) {
+                    bool reached = false;
+                    for (size_t w = 0; w < laneWords; w++) {
+                        uint64_t fresh = next[vertex * laneWords + w];
+                        if (fresh == 0) continue;
+                        next[vertex * laneWords + w] = 0;
+                        seen[vertex * laneWords + w] |= fresh;
+                        visit[vertex * laneWords + w] = fresh;
+                        reached = true;
+                        for (; fresh != 0; fresh &= fresh - 1) distances[first + w * BitSet::WordBits + std::countr_zero(fresh)][vertex] = level;
+                    }
+                    if (reached) discovered[worker].push_back(vertex);
+                }
+            });
+            frontier.clear();
+            for (auto& local : discovered) {
+                frontier.insert(frontier.end(), local.begin(), local.end());
+                local.clear();
+            }
+        }
+    }
+
+    static constexpr size_t FloydTileSize = 64;
+
+    // Min-plus update of one tile: c[i][j] = min(c[i][j], a[i][k] + b[k][j]); the j loop is branch-free so it vectorizes.
+    // Integer tiles use numeric_limits<E>::max() as infinity, so a sum only counts when both terms are finite: the add is
+    // done in unsigned arithmetic, which cannot trap, and a select drops it when b[k][j] is infinite
+    static void floydTile(E* c, const E* a, const E* b, size_t stride) {
+        constexpr E infinity = std::numeric_limits<E>::has_infinity ? std::numeric_limits<E>::infinity() : std::numeric_limits<E>::max();
+        for (size_t k = 0; k < FloydTileSize; k++) {
+            const E* bRow = b + k * stride;
+            for (size_t i = 0; i < FloydTileSize; i++) {
+                const E aik = a[i * stride + k];
+                E* cRow = c + i * stride;
+                if constexpr (std::is_floating_point_v<E>) {
+                    for (size_t j = 0; j < FloydTileSize; j++) cRow[j] = std::min(cRow[j], aik + bRow[j]);
+                }
+                else {
+                    using U = std::make_unsigned_t<E>;
+                    if (aik == infinity) continue;
+                    for (size_t j = 0; j < FloydTileSize; j++) {
+                        const E sum = static_cast<E>(static_cast<U>(aik) + static_cast<U>(bRow[j]));
+                        cRow[j] = std::min(cRow[j], bRow[j] == infinity ? infinity : sum);
+                    }
+                }
+            }
+        }
+    }
+
+    using Frontier = typename ShortestPathScratch::Frontier;
+
+    static ShortestPathScratch& threadScratch() {
+        thread_local ShortestPathScratch scratch;
+        return scratch;
+    }
+
+    // One relaxation step of an s-t search; returns false if the edge did not improve vertex
+    static bool relaxTowards(Frontier& frontier, uint32_t generation, size_t from, size_t vertex, E weight, E keyOffset) {
+        if (frontier.settled[vertex] == generation) return false;
+        E candidate = frontier.distance[from] + weight;
+        bool queued = frontier.reached[vertex] == generation;
+        if (queued && !(candidate < frontier.distance[vertex])) return false;
+        frontier.reached[vertex] = generation;
+        frontier.distance[vertex] = candidate;
+        frontier.predecessor[vertex] = from;
+        frontier.push(vertex, candidate + keyOffset, queued);
+        return true;
+    }
+
+    void startSearch(Frontier& frontier, uint32_t generation, size_t vertex, E key) const {
+        frontier.reached[vertex] = generation;
+        frontier.distance[vertex] = 0;
+        frontier.predecessor[vertex] = graph.vertices.size();
+        frontier.push(vertex, key, false);
+    }
+
+    void appendChain(const Frontier& frontier, size_t vertex, std::vector<size_t>& path) const {
+        for (; vertex != graph.vertices.size(); vertex = frontier.predecessor[vertex]) path.push_back(vertex);
+    }
+
+    std::expected<E, DataStructureError> bidirectionalSearch(size_t source, size_t target, std::vector<size_t>& path, ShortestPathScratch& scratch) const {
+        const size_t vertexCount = graph.vertices.size();
+        const uint32_t generation = scratch.generation;
+        Frontier& forward = scratch.forward;
+        Frontier& backward = scratch.backward;
+        startSearch(forward, generation, source, 0);
+        startSearch(backward, generation, target, 0);
+        E best = std::numeric_limits<E>::max();
+        size_t meeting = source == target ? source : vertexCount;
+        if (meeting == source) best = 0;
+        while (!forward.heap.empty() && !backward.heap.empty()) {
+            if (!(forward.key[forward.heap[0]] + backward.key[backward.heap[0]] < best)) break;
+            const bool forwardStep = forward.heap.size() <= backward.heap.size();
+            Frontier& current = forwardStep ? forward : backward;
+            Frontier& other = forwardStep ? backward : forward;
+            size_t u = current.pop();
+            current.settled[u] = generation;
+            auto relax = [&](size_t v, E weight) {
+                relaxTowards(current, generation, u, v, weight, 0);
+                if (other.reached[v] == generation && current.reached[v] == generation && current.distance[v] + other.distance[v] < best) {
+                    best = current.distance[v] + other.distance[v];
+                    meeting = v;
+                }
+            };
+            if (forwardStep || graph.graphType == GraphType::Undirected) forEachNeighbour(u, [&](size_t v) { relax(v, graph.edges.weight(u, v)); });
+            else for (size_t v = 0; v < vertexCount; v++) if (graph.edges.hasEdge(v, u)) relax(v, graph.edges.weight(v, u));
+        }
+        if (meeting == vertexCount) return std::unexpected(DataStructureError::ElementNotFound);
+        appendChain(forward, meeting, path);
+        std::reverse(path.begin(), path.end());
+        if (meeting != target) appendChain(backward, backward.predecessor[meeting], path);
+        return best;
+    }
+
+    // Makes room for start -> end in the order, touching only vertices between position[end] and position[start]; false if the edge closes a cycle
+    bool reorderForEdge(size_t start, size_t end) {
+        TopologicalOrder& order = topologicalOrder;
+        if (start == end) return false;
+        const size_t lower = order.position[end];
+        const size_t upper = order.position[start];
+        if (upper < lower) return true;
+        bool cycle = false;
+        order.forward.clear();
+        order.pending.assign(1, end);
+        order.visited.set(end);
+        while (!order.pending.empty() && !cycle) {
+            size_t vertex = order.pending.back();
+            order.pending.pop_back();
+            order.forward.push_back(vertex);
+            forEachNeighbour(vertex, [&](size_t next) {
+                if (next == start) cycle = true;
+                else if (order.position[next] < upper && order.visited.testAndSet(next)) order.pending.push_back(next);
+            });
+        }
+        for (size_t vertex : order.pending) order.forward.push_back(vertex);
+        if (cycle) {
+            for (size_t vertex : order.forward) order.visited.reset(vertex);
+            return false;
+        }
+        order.backward.clear();
+        order.pending.assign(1, start);
+        order.visited.set(start);
+        while (!order.pending.empty()) {
+            size_t vertex = order.pending.back();
+            order.pending.pop_back();
+            order.backward.push_back(vertex);
+            for (size_t previous = 0; previous < graph.vertices.size(); previous++) {
+                if (!graph.edges.hasEdge(previous, vertex) || order.position[previous] <= lower) continue;
+                if (order.visited.testAndSet(previous)) order.pending.push_back(previous);
+            }
+        }
+        auto byPosition = [&order](size_t a, size_t b) { return order.position[a] < order.position[b]; };
+        std::sort(order.forward.begin(), order.forward.end(), byPosition);
+        std::sort(order.backward.begin(), order.backward.end(), byPosition);
+        order.slots.clear();
+        for (size_t vertex : order.backward) order.slots.push_back(order.position[vertex]);
+        for (size_t vertex : order.forward) order.slots.push_back(order.position[vertex]);
+        std::sort(order.slots.begin(), order.slots.end());
+        size_t slot = 0;
+        for (auto* affected : {&order.backward, &order.forward}) {
+            for (size_t vertex : *affected) {
+                order.visited.reset(vertex);
+                order.position[vertex] = order.slots[slot];
+                order.vertexAt[order.slots[slot++]] = vertex;
+            }
+        }
+        return true;
+    }
+
+    // Mirrors EdgeMatrix::swapRemove: index leaves the order and the last vertex takes over its index
+    void removeFromOrder(size_t index) {
+        TopologicalOrder& order = topologicalOrder;
+        const size_t last = order.vertexAt.size() - 1;
+        const size_t removed = order.position[index];
+        order.vertexAt.erase(order.vertexAt.begin() + removed);
+        for (size_t p = removed; p < last; p++) order.position[order.vertexAt[p]] = p;
+        if (index != last) {
+            order.position[index] = order.position[last];
+            order.vertexAt[order.position[index]] = index;
+        }
+        order.position.pop_back();
+        order.visited.resize(last);
+    }
+
+    void rebuildConnectivity() {
+        const size_t vertexCount = graph.vertices.size();
+        connectivity.components.reset(vertexCount);
+        connectivity.stamp.assign(vertexCount, 0);
+        connectivity.generation = 0;
+        for (size_t i = 0; i < vertexCount; i++) {
+            for (size_t j = graph.edges.nextNeighbour(i, i + 1); j < vertexCount; j = graph.edges.nextNeighbour(i, j + 1)) connectivity.components.unite(i, j);
+        }
+    }
+
+    // Called after start - end is gone: BFS from both ends in lockstep. If they meet, nothing changed; otherwise the
+    // search that ran dry has collected the smaller side, which is split off the old component
+    void splitIfDisconnected(size_t start, size_t end) {
+        const size_t vertexCount = graph.vertices.size();
+        if (connectivity.generation >= std::numeric_limits<uint32_t>::max() - 2) {
+            std::fill(connectivity.stamp.begin(), connectivity.stamp.end(), 0);
+            connectivity.generation = 0;
+        }
+        const uint32_t marks[2] = {connectivity.generation + 1, connectivity.generation + 2};
+        connectivity.generation += 2;
+        std::vector<size_t> queues[2] = {{start}, {end}};
+        size_t heads[2] = {0, 0};
+        connectivity.stamp[start] = marks[0];
+        connectivity.stamp[end] = marks[1];
+        size_t side = 0;
+        while (true) {
+            if (heads[side] == queues[side].size()) break;
+            const size_t vertex = queues[side][heads[side]++];
+            for (size_t next = graph.edges.nextNeighbour(vertex, 0); next < vertexCount; next = graph.edges.nextNeighbour(vertex, next + 1)) {
+                if (connectivity.stamp[next] == marks[1 - side]) return;
+                if (connectivity.stamp[next] == marks[side]) continue;
+                connectivity.stamp[next] = marks[side];
+                queues[side].push_back(next);
+            }
+            side = 1 - side;
+        }
+        connectivity.components.splitOff(queues[side]);
+    }
+
+    std::vector<V> toVertices(const std::vector<size_t>& indices, const std::function<void(V)>& visitor) const {
+        std::vector<V> vertices;
+        vertices.reserve(indices.size());
+        for (size_t index : indices) {
+            vertices.push_back(graph.vertices[index]);
+            visitor(graph.vertices[index]);
+        }
+        return vertices;
+    }
+
+    // Strict total order on undirected edges (start < end): ties on weight never leave two MST candidates equal
+    static bool lighterEdge(const Edge& a, const Edge& b) {
+        if (a.weight < b.weight) return true;
+        if (b.weight < a.weight) return false;
+        return a.start != b.start ? a.start < b.start : a.end < b.end;
+    }
+
+    std::vector<Edge> collectUndirectedEdges(ThreadPool& pool) const {
+        const size_t vertexCount = graph.vertices.size();
+        std::vector<std::vector<Edge>> local(pool.getThreadCount());
+        pool.parallelFor(0, vertexCount, [&](size_t begin, size_t end, size_t worker) {
+            for (size_t i = begin; i < end; i++) {
+                for (size_t j = graph.edges.nextNeighbour(i, i + 1); j < vertexCount; j = graph.edges.nextNeighbour(i, j + 1)) local[worker].push_back({i, j, graph.edges.weight(i, j)});
+            }
+        });
+        std::vector<Edge> edges;
+        for (auto& part : local) edges.insert(edges.end(), part.begin(), part.end());
+        return edges;
+    }
+
+    // Neighbours in either direction, each listed once and sorted, as offsets / targets; orderings work on this
+    // symmetric structure so an edge pulls its endpoints together whichever way it points
+    void symmetricAdjacency(std::vector<size_t>& offsets, std::vector<size_t>& targets) const {
+        const size_t vertexCount = graph.vertices.size();
+        const bool directed = graph.graphType == GraphType::Directed;
+        offsets.assign(vertexCount + 1, 0);
+        for (size_t i = 0; i < vertexCount; i++) {
+            forEachNeighbour(i, [&](size_t j) {
+                offsets[i + 1]++;
+                if (directed && !graph.edges.hasEdge(j, i)) offsets[j + 1]++;
+            });
+        }
+        for (size_t i = 0; i < vertexCount; i++) offsets[i + 1] += offsets[i];
+        targets.resize(offsets[vertexCount]);
+        std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < vertexCount; i++) {
+            forEachNeighbour(i, [&](size_t j) {
+                targets[cursor[i]++] = j;
+                if (directed && !graph.edges.hasEdge(j, i)) targets[cursor[j]++] = i;
+            });
+        }
+        for (size_t i = 0; i < vertexCount; i++) std::sort(targets.begin() + offsets[i], targets.begin() + offsets[i + 1]);
+    }
+
+    // BFS order over every component. Plain BFS starts components at the lowest unvisited index and takes neighbours in
+    // index order; Cuthill-McKee starts each component at a pseudo-peripheral vertex (George and Liu) and takes neighbours
+    // by increasing degree, so consecutive levels end up in narrow index bands
+    std::vector<size_t> breadthFirstOrdering(const std::vector<size_t>& offsets, const std::vector<size_t>& targets, bool cuthillMcKee) const {
+        const size_t vertexCount = graph.vertices.size();
+        auto degree = [&](size_t vertex) { return offsets[vertex + 1] - offsets[vertex]; };
+        std::vector<size_t> order;
+        order.reserve(vertexCount);
+        std::vector<size_t> stamp(vertexCount, 0);
+        size_t generation = 0;
+        // Levels of a BFS from root inside its component; leaves the last level in level and returns the eccentricity
+        std::vector<size_t> level;
+        std::vector<size_t> nextLevel;
+        auto lastLevel = [&](size_t root) {
+            generation++;
+            stamp[root] = generation;
+            level.assign(1, root);
+            size_t eccentricity = 0;
+            while (true) {
+                nextLevel.clear();
+                for (size_t vertex : level) {
+                    for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; k++) {
+                        if (stamp[targets[k]] == generation) continue;
+                        stamp[targets[k]] = generation;
+                        nextLevel.push_back(targets[k]);
+                    }
+                }
+                if (nextLevel.empty()) return eccentricity;
+                level.swap(nextLevel);
+                eccentricity++;
+            }
+        };
+        std::vector<size_t> roots(vertexCount);
+        std::iota(roots.begin(), roots.end(), 0);
+        if (cuthillMcKee) std::stable_sort(roots.begin(), roots.end(), [&](size_t a, size_t b) { return degree(a) < degree(b); });
+        BitSet placed(vertexCount);
+        std::vector<size_t> neighbours;
+        for (size_t root : roots) {
+            if (placed.test(root)) continue;
+            if (cuthillMcKee) {
+                size_t eccentricity = lastLevel(root);
+                while (true) {
+                    size_t candidate = *std::min_element(level.begin(), level.end(), [&](size_t a, size_t b) { return degree(a) < degree(b); });
+                    size_t candidateEccentricity = lastLevel(candidate);
+                    if (candidateEccentricity <= eccentricity) break;
+                    root = candidate;
+                    eccentricity = candidateEccentricity;
+                }
+            }
+            placed.set(root);
+            order.push_back(root);
+            for (size_t head = order.size() - 1; head < order.size(); head++) {
+                const size_t vertex = order[head];
+                neighbours.clear();
+                for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; k++) {
+                    if (!placed.test(targets[k])) neighbours.push_back(targets[k]);
+                }
+                if (cuthillMcKee) std::stable_sort(neighbours.begin(), neighbours.end(), [&](size_t a, size_t b) { return degree(a) < degree(b); });
+                for (size_t neighbour : neighbours) {
+                    placed.set(neighbour);
+                    order.push_back(neighbour);
+                }
+            }
+        }
+        if (cuthillMcKee) std::reverse(order.begin(), order.end());
+        return order;
+    }
+
+    static constexpr size_t FilterKruskalCutoff = 1024;
+
+    // Osipov, Sanders and Singler: solve the light half first, then drop heavy edges whose endpoints it already joined before they are ever sorted
+    void filterKruskal(std::vector<Edge>& edges, size_t begin, size_t end, DenseUnionFindSet& components, std::vector<Edge>& forest, ThreadPool& pool) const {
+        const size_t vertexCount = graph.vertices.size();
+        if (begin == end || forest.size() + 1 == vertexCount) return;
+        if (end - begin <= std::max(FilterKruskalCutoff, vertexCount)) {
+            std::sort(edges.begin() + begin, edges.begin() + end, lighterEdge);
+            for (size_t k = begin; k < end && forest.size() + 1 < vertexCount; k++) {
+                if (components.unite(edges[k].start, edges[k].end)) forest.push_back(edges[k]);
+            }
+            return;
+        }
+        const Edge& first = edges[begin];
+        const Edge& middle = edges[begin + (end - begin) / 2];
+        const Edge& last = edges[end - 1];
+        // Median of three distinct edges, so both halves are non-empty and the recursion always shrinks
+        const Edge pivot = lighterEdge(first, middle) ? (lighterEdge(middle, last) ? middle : (lighterEdge(first, last) ? last : first))
+                                                      : (lighterEdge(first, last) ? first : (lighterEdge(middle, last) ? last : middle));
+        const size_t split = std::partition(edges.begin() + begin, edges.begin() + end, [&pivot](const Edge& edge) { return !lighterEdge(pivot, edge); }) - edges.begin();
+        filterKruskal(edges, begin, split, components, forest, pool);
+        if (forest.size() + 1 == vertexCount) return;
+        // Roots of every vertex up front, so the filter pass only reads
+        std::vector<size_t> vertices(vertexCount);
+        std::iota(vertices.begin(), vertices.end(), 0);
+        std::vector<size_t> roots(vertexCount);
+        components.find(vertices, roots);
+        std::vector<uint8_t> keep(end - split);
+        pool.parallelFor(split, end, [&](size_t chunkBegin, size_t chunkEnd, size_t) {
+            for (size_t k = chunkBegin; k < chunkEnd; k++) keep[k - split] = roots[edges[k].start] != roots[edges[k].end];
+        });
+        size_t kept = split;
+        for (size_t k = split; k < end; k++) if (keep[k - split]) edges[kept++] = edges[k];
+        filterKruskal(edges, split, kept, components, forest, pool);
     }
 
 public:
     explicit AdjacencyMatrixGraph(GraphType type = GraphType::Directed) : graph{.graphType = type} {}
 
+    // Bulk construction in one pass over edges: Edge::start / Edge::end are indices into vertices, undirected edges are
+    // listed once and mirrored, and a repeated edge keeps its first weight. A repeated vertex collapses onto its first
+    // occurrence (edges naming the copy are redirected there); edges with an index past the end are skipped
+    AdjacencyMatrixGraph(std::vector<V> vertices, const std::vector<Edge>& edges, GraphType type = GraphType::Directed) : graph{.vertices = {}, .edges = {}, .graphType = type} {
+        const std::vector<size_t> position = deduplicateVertices(vertices, graph.vertices, vertexIndex);
+        graph.edges.resize(graph.vertices.size());
+        for (const auto& edge : edges) {
+            if (edge.start >= position.size() || edge.end >= position.size()) continue;
+            const size_t start = position[edge.start];
+            const size_t end = position[edge.end];
+            if (graph.edges.hasEdge(start, end)) continue;
+            graph.edges.setEdge(start, end, edge.weight);
+            if (graph.graphType == GraphType::Undirected) graph.edges.setEdge(end, start, edge.weight);
+        }
+    }
+
     ~AdjacencyMatrixGraph() = default;
 
     bool isEmpty() const { return graph.vertices.empty(); }
 
+    const Graph& getGraph() const { return graph; }
+
     bool hasVertex(V vertex) const { return findVertexIndex(vertex).has_value(); }
 
+    std::expected<size_t, DataStructureError> getVertexIndex(V vertex) const { return findVertexIndex(vertex); }
+
+    std::expected<V, DataStructureError> getVertex(size_t index) const {
+        if (!isValidIndex(index)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        return graph.vertices[index];
+    }
+
     bool hasEdge(V start, V end) const {
-        TRY(startIndex, findVertexIndex(start));
-        TRY(endIndex, findVertexIndex(end));
-        return graph.edges[startIndex][endIndex] != E{};
+        auto startIndex = findVertexIndex(start);
+        auto endIndex = findVertexIndex(end);
+        if (!startIndex || !endIndex) return false;
+        return hasEdgeByIndex(*startIndex, *endIndex);
     }
 
-    E getEdge(V start, V end) const {
+    bool hasEdgeByIndex(size_t startIndex, size_t endIndex) const {
+        if (!isValidIndex(startIndex) || !isValidIndex(endIndex)) return false;
+        return graph.edges.hasEdge(startIndex, endIndex);
+    }
+
+    std::expected<E, DataStructureError> getEdge(V start, V end) const {
         TRY(startIndex, findVertexIndex(start));
         TRY(endIndex, findVertexIndex(end));
-        return graph.edges[startIndex][endIndex];
+        return getEdgeByIndex(startIndex, endIndex);
+    }
+
+    std::expected<E, DataStructureError> getEdgeByIndex(size_t startIndex, size_t endIndex) const {
+        if (!isValidIndex(startIndex) || !isValidIndex(endIndex)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        if (!graph.edges.hasEdge(startIndex, endIndex)) return std::unexpected(DataStructureError::ElementNotFound);
+        return graph.edges.weight(startIndex, endIndex);
     }
 
     std::expected<std::vector<V>, DataStructureError> getVertices(std::function<void(V)> visitor) const {
@@ -65,18 +828,14 @@ public:
     std::expected<std::vector<V>, DataStructureError> getNeighbours(V vertex, std::function<void(V)> visitor) const {
         TRY(index, findVertexIndex(vertex));
         std::vector<V> neighbours;
-        for (size_t i = 0; i < graph.vertices.size(); i++) if (graph.edges[index][i] != E{}) neighbours.push_back(graph.vertices[i]);
+        forEachNeighbour(index, [&](size_t neighbour) { neighbours.push_back(graph.vertices[neighbour]); });
         for (const auto& neighbour : neighbours) visitor(neighbour);
         return neighbours;
     }
 
     std::expected<size_t, DataStructureError> getDegree(V vertex) const {
         TRY(index, findVertexIndex(vertex));
-        if (graph.graphType == GraphType::Undirected) {
-            size_t degree = 0;
-            for (const auto& edge : graph.edges[index]) if (edge != E{}) degree++;
-            return degree;
-        }
+        if (graph.graphType == GraphType::Undirected) return graph.edges.rowDegree(index);
         else {
             TRY(inDegree, getInDegree(vertex));
             TRY(outDegree, getOutDegree(vertex));
@@ -88,48 +847,84 @@ public:
         if (graph.graphType == GraphType::Undirected) return getDegree(vertex);    // In undirected graph, degree is equal to in-degree and out-degree
         TRY(index, findVertexIndex(vertex));
         size_t inDegree = 0;
-        for(size_t i = 0; i < graph.vertices.size(); i++) if (graph.edges[i][index] != E{}) inDegree++;
+        for (size_t i = 0; i < graph.vertices.size(); i++) if (graph.edges.hasEdge(i, index)) inDegree++;
         return inDegree;
     }
 
     std::expected<size_t, DataStructureError> getOutDegree(V vertex) const {
         if (graph.graphType == GraphType::Undirected) return getDegree(vertex);
         TRY(index, findVertexIndex(vertex));
-        size_t outDegree = 0;
-        for (const auto& edge : graph.edges[index]) if (edge != E{}) outDegree++;
-        return outDegree;
+        return graph.edges.rowDegree(index);
     }
 
     std::expected<void, DataStructureError> addVertex(V vertex) {
-        if (findVertexIndex(vertex).has_value()) return std::unexpected(DataStructureError::DuplicateValue);
+        if (!vertexIndex.emplace(vertex, graph.vertices.size()).second) return std::unexpected(DataStructureError::DuplicateValue);
         graph.vertices.push_back(vertex);
-        for (auto& row : graph.edges) row.push_back(E{});
-        graph.edges.push_back(std::vector<E>(graph.vertices.size(), E{}));
+        graph.edges.addVertex();
+        reachability.valid = false;
+        if (connectivity.enabled) {
+            connectivity.components.addElement();
+            connectivity.stamp.push_back(0);
+        }
+        if (topologicalOrder.enabled) {
+            topologicalOrder.position.push_back(topologicalOrder.vertexAt.size());
+            topologicalOrder.vertexAt.push_back(graph.vertices.size() - 1);
+            topologicalOrder.visited.resize(graph.vertices.size());
+        }
         return {};
     }
     
     std::expected<void, DataStructureError> removeVertex(V vertex) {
         TRY(index, findVertexIndex(vertex));
-        graph.vertices.erase(graph.vertices.begin() + index);
-        graph.edges.erase(graph.edges.begin() + index);
-        for (auto& row : graph.edges) row.erase(row.begin() + index);
+        // Dropping an isolated vertex only renames the last one; anything else may split a component
+        const bool isolated = graph.edges.rowDegree(index) == graph.edges.hasEdge(index, index);
+        vertexIndex.erase(vertex);
+        if (index + 1 != graph.vertices.size()) {
+            graph.vertices[index] = graph.vertices.back();
+            vertexIndex[graph.vertices[index]] = index;
+        }
+        graph.vertices.pop_back();
+        graph.edges.swapRemove(index);
+        reachability.valid = false;
+        if (topologicalOrder.enabled) removeFromOrder(index);
+        if (connectivity.enabled && !isolated) rebuildConnectivity();
+        else if (connectivity.enabled) {
+            connectivity.components.swapRemove(index);
+            connectivity.stamp.pop_back();
+        }
         return {};
     }
 
     std::expected<void, DataStructureError> addEdge(V start, V end, E edge) {
         TRY(startIndex, findVertexIndex(start));
         TRY(endIndex, findVertexIndex(end));
-        if (graph.edges[startIndex][endIndex] != E{}) return std::unexpected(DataStructureError::DuplicateValue);
-        graph.edges[startIndex][endIndex] = edge;
-        if (graph.graphType == GraphType::Undirected) graph.edges[endIndex][startIndex] = edge;
+        return addEdgeByIndex(startIndex, endIndex, edge);
+    }
+
+    std::expected<void, DataStructureError> addEdgeByIndex(size_t startIndex, size_t endIndex, E edge) {
+        if (!isValidIndex(startIndex) || !isValidIndex(endIndex)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        if (graph.edges.hasEdge(startIndex, endIndex)) return std::unexpected(DataStructureError::DuplicateValue);
+        if (topologicalOrder.enabled && !reorderForEdge(startIndex, endIndex)) return std::unexpected(DataStructureError::CycleDetected);
+        graph.edges.setEdge(startIndex, endIndex, edge);
+        if (graph.graphType == GraphType::Undirected) graph.edges.setEdge(endIndex, startIndex, edge);
+        reachability.valid = false;
+        if (connectivity.enabled) connectivity.components.unite(startIndex, endIndex);
         return {};
     }
 
     std::expected<void, DataStructureError> removeEdge(V start, V end) {
         TRY(startIndex, findVertexIndex(start));
         TRY(endIndex, findVertexIndex(end));
-        graph.edges[startIndex][endIndex] = E{};
-        if (graph.graphType == GraphType::Undirected) graph.edges[endIndex][startIndex] = E{};
+        return removeEdgeByIndex(startIndex, endIndex);
+    }
+
+    std::expected<void, DataStructureError> removeEdgeByIndex(size_t startIndex, size_t endIndex) {
+        if (!isValidIndex(startIndex) || !isValidIndex(endIndex)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        const bool existed = graph.edges.hasEdge(startIndex, endIndex);
+        graph.edges.removeEdge(startIndex, endIndex);
+        if (graph.graphType == GraphType::Undirected) graph.edges.removeEdge(endIndex, startIndex);
+        reachability.valid = false;
+        if (connectivity.enabled && existed && startIndex != endIndex) splitIfDisconnected(startIndex, endIndex);
         return {};
     }
 
@@ -141,170 +936,500 @@ public:
     std::expected<size_t, DataStructureError> getEdgeCount() const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
         size_t edgeCount = 0;
-        for (const auto& row : graph.edges) for (const auto& edge : row) if (edge != E{}) edgeCount++;
+        for (size_t i = 0; i < graph.vertices.size(); i++) edgeCount += graph.edges.rowDegree(i);
         return edgeCount;
     }
 
     std::expected<std::vector<V>, DataStructureError> DFSRecursive(V start, std::function<void(V)> visitor) const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
         TRY(startIndex, findVertexIndex(start));
-        std::vector<V> visited;
-        std::function<std::expected<void, DataStructureError>(size_t)> DFS = [&](size_t index) -> std::expected<void, DataStructureError> {
-            visited.push_back(graph.vertices[index]);
-            visitor(graph.vertices[index]);
-            TRY(vertexCount, getVertexCount());
-            for (size_t i = 0; i < vertexCount; ++i) {
-                if (graph.edges[index][i] != E{}) {
-                    bool isVisited = std::find(visited.begin(), visited.end(), graph.vertices[i]) != visited.end();
-                    if (!isVisited) {
-                        auto res = DFS(i);
-                        if (!res.has_value()) return res;
-                    }
-                }
-            }
-            return {};
-        };
-        auto dfsRes = DFS(startIndex);
-        if (!dfsRes.has_value()) return std::unexpected(dfsRes.error());
-        return visited;
+        std::vector<size_t> order;
+        BitSet visited(graph.vertices.size());
+        DFSRecursiveFrom(startIndex, visited, order);
+        return toVertices(order, visitor);
     }
 
     std::expected<std::vector<V>, DataStructureError> DFSIterative(V start, std::function<void(V)> visitor) const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
         TRY(startIndex, findVertexIndex(start));
-        std::vector<V> visited;
-        std::stack<size_t> unvisited;
-        unvisited.push(startIndex);
+        TRY(order, DFSByIndex(startIndex));
+        return toVertices(order, visitor);
+    }
+
+    // Same visit order as DFSIterative, but the stack holds one (vertex, cursor) frame per vertex on the current path
+    std::expected<std::vector<size_t>, DataStructureError> DFSByIndex(size_t startIndex) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (!isValidIndex(startIndex)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        const size_t vertexCount = graph.vertices.size();
+        std::vector<size_t> order;
+        BitSet visited(vertexCount);
+        std::vector<std::pair<size_t, size_t>> unvisited;
+        visited.set(startIndex);
+        order.push_back(startIndex);
+        unvisited.push_back({startIndex, vertexCount});
         while (!unvisited.empty()) {
-            size_t currentIndex = unvisited.top();
-            unvisited.pop();
-            bool isVisited = std::find(visited.begin(), visited.end(), graph.vertices[currentIndex]) != visited.end();
-            if (isVisited) continue;
-            visited.push_back(graph.vertices[currentIndex]);
-            visitor(graph.vertices[currentIndex]);
-            TRY(vertexCount, getVertexCount());
-            for (size_t i = 0; i < vertexCount; i++) {
-                if (graph.edges[currentIndex][i] != E()) {
-                    bool neighbourVisited = std::find(visited.begin(), visited.end(), graph.vertices[i]) != visited.end();
-                    if (!neighbourVisited) unvisited.push(i);
-                }
+            auto& [currentIndex, cursor] = unvisited.back();
+            size_t next = graph.edges.previousNeighbour(currentIndex, cursor);
+            while (next != vertexCount && visited.test(next)) next = graph.edges.previousNeighbour(currentIndex, next);
+            if (next == vertexCount) {
+                unvisited.pop_back();
+                continue;
             }
+            cursor = next;
+            visited.set(next);
+            order.push_back(next);
+            unvisited.push_back({next, vertexCount});
         }
-        return visited;
+        return order;
     }
 
     std::expected<std::vector<V>, DataStructureError> BFS(V start, std::function<void(V)> visitor) const {
-    if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
         TRY(startIndex, findVertexIndex(start));
-        std::vector<V> visited;
-        std::queue<size_t> unvisited;
-        unvisited.push(startIndex);
-        while (!unvisited.empty()) {
-            size_t currentIndex = unvisited.front();
-            unvisited.pop();
-            bool isVisited = std::find(visited.begin(), visited.end(), graph.vertices[currentIndex]) != visited.end();
-            if (isVisited) continue;
-            visited.push_back(graph.vertices[currentIndex]);
-            visitor(graph.vertices[currentIndex]);
-            TRY(vertexCount, getVertexCount());
-            for (size_t i = 0; i < graph.vertices.size(); i++) {
-                if (graph.edges[currentIndex][i] != E{}) {
-                    bool neighbourVisited = std::find(visited.begin(), visited.end(), graph.vertices[i]) != visited.end();
-                    if (!neighbourVisited) unvisited.push(i);
-                }
-            }
+        TRY(order, BFSByIndex(startIndex));
+        return toVertices(order, visitor);
+    }
+
+    std::expected<std::vector<size_t>, DataStructureError> BFSByIndex(size_t startIndex) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (!isValidIndex(startIndex)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        std::vector<size_t> order;
+        BitSet visited(graph.vertices.size());
+        visited.set(startIndex);
+        order.push_back(startIndex);
+        for (size_t head = 0; head < order.size(); head++) {
+            forEachNeighbour(order[head], [&](size_t neighbour) {
+                if (visited.testAndSet(neighbour)) order.push_back(neighbour);
+            });
         }
-        return visited;
+        return order;
+    }
+
+    std::expected<std::vector<V>, DataStructureError> BFS(V start, ThreadPool& pool, std::function<void(V)> visitor) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        TRY(order, BFSByIndex(startIndex, pool));
+        return toVertices(order, visitor);
+    }
+
+    // Parallel, direction-optimizing BFS; returns exactly the same order as the sequential BFSByIndex
+    std::expected<std::vector<size_t>, DataStructureError> BFSByIndex(size_t startIndex, ThreadPool& pool) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (!isValidIndex(startIndex)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        return parallelBFS(startIndex, pool, true, graph.vertices.size());
+    }
+
+    std::expected<std::vector<std::vector<size_t>>, DataStructureError> multiSourceBFS(const std::vector<V>& sources, ThreadPool& pool) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        std::vector<size_t> sourceIndices;
+        sourceIndices.reserve(sources.size());
+        for (const auto& source : sources) {
+            TRY(index, findVertexIndex(source));
+            sourceIndices.push_back(index);
+        }
+        return multiSourceBFSByIndex(sourceIndices, pool);
+    }
+
+    // Hop distances from every source (row per source, numeric_limits<size_t>::max() when unreachable). Up to
+    // MultiSourceBatch sources share one sweep over the rows per level; larger source lists run batch after batch
+    std::expected<std::vector<std::vector<size_t>>, DataStructureError> multiSourceBFSByIndex(const std::vector<size_t>& sources, ThreadPool& pool) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        for (size_t source : sources) if (!isValidIndex(source)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        std::vector<std::vector<size_t>> distances(sources.size(), std::vector<size_t>(graph.vertices.size(), std::numeric_limits<size_t>::max()));
+        for (size_t begin = 0; begin < sources.size(); begin += MultiSourceBatch) {
+            multiSourceBatch(sources, begin, std::min(begin + MultiSourceBatch, sources.size()), distances, pool);
+        }
+        return distances;
     }
 
     std::expected<bool, DataStructureError> hasPath(V start, V end) const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
         TRY(startIndex, findVertexIndex(start));
         TRY(endIndex, findVertexIndex(end));
-        bool found = false;
-        if (startIndex == endIndex) found = true;
-        auto result = BFS(start, [&found, end, this](V vertex) { if (vertex == end) found = true; });
-        return found;
+        return hasPathByIndex(startIndex, endIndex);
+    }
+
+    std::expected<bool, DataStructureError> hasPath(V start, V end, ThreadPool& pool) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        TRY(endIndex, findVertexIndex(end));
+        if (startIndex == endIndex) return true;
+        if (connectivity.enabled) return connectivity.components.isConnected(startIndex, endIndex);
+        if (reachability.valid) return reachesByIndex(startIndex, endIndex);
+        auto reached = parallelBFS(startIndex, pool, false, endIndex);
+        return std::find(reached.begin(), reached.end(), endIndex) != reached.end();
+    }
+
+    std::expected<bool, DataStructureError> hasPathByIndex(size_t startIndex, size_t endIndex) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (!isValidIndex(startIndex) || !isValidIndex(endIndex)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        if (startIndex == endIndex) return true;
+        if (connectivity.enabled) return connectivity.components.isConnected(startIndex, endIndex);
+        if (reachability.valid) return reachesByIndex(startIndex, endIndex);
+        std::vector<size_t> unvisited;
+        BitSet visited(graph.vertices.size());
+        visited.set(startIndex);
+        unvisited.push_back(startIndex);
+        for (size_t head = 0; head < unvisited.size(); head++) {
+            size_t currentIndex = unvisited[head];
+            for (size_t i = graph.edges.nextNeighbour(currentIndex, 0); i < graph.vertices.size(); i = graph.edges.nextNeighbour(currentIndex, i + 1)) {
+                if (!visited.testAndSet(i)) continue;
+                if (i == endIndex) return true;
+                unvisited.push_back(i);
+            }
+        }
+        return false;
+    }
+
+    std::expected<void, DataStructureError> buildReachabilityIndex() {
+        ThreadPool pool(1);
+        return buildReachabilityIndex(pool);
+    }
+
+    // Word-parallel Warshall: row i |= row k whenever i reaches k, with the rows of each k step split across the pool.
+    // O(V^3 / 64) once, after which hasPath is a single bit test until the graph changes
+    std::expected<void, DataStructureError> buildReachabilityIndex(ThreadPool& pool) {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        const size_t vertexCount = graph.vertices.size();
+        const size_t rowWords = (vertexCount + BitSet::WordBits - 1) / BitSet::WordBits;
+        reachability.rowWords = rowWords;
+        reachability.bits.assign(vertexCount * rowWords, 0);
+        uint64_t* bits = reachability.bits.data();
+        pool.parallelFor(0, vertexCount, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; i++) {
+                std::copy_n(graph.edges.presenceRow(i), rowWords, bits + i * rowWords);
+                bits[i * rowWords + i / BitSet::WordBits] |= uint64_t{1} << (i % BitSet::WordBits);
+            }
+        });
+        for (size_t k = 0; k < vertexCount; k++) {
+            const uint64_t* through = bits + k * rowWords;
+            const size_t word = k / BitSet::WordBits;
+            const uint64_t mask = uint64_t{1} << (k % BitSet::WordBits);
+            pool.parallelFor(0, vertexCount, [&](size_t begin, size_t end, size_t) {
+                for (size_t i = begin; i < end; i++) {
+                    uint64_t* row = bits + i * rowWords;
+                    if (i == k || !(row[word] & mask)) continue;
+                    for (size_t w = 0; w < rowWords; w++) row[w] |= through[w];
+                }
+            });
+        }
+        reachability.valid = true;
+        return {};
+    }
+
+    bool isReachabilityIndexValid() const { return reachability.valid; }
+
+    // Answers from the reachability index; only meaningful while isReachabilityIndexValid()
+    bool reachesByIndex(size_t startIndex, size_t endIndex) const {
+        return (reachability.bits[startIndex * reachability.rowWords + endIndex / BitSet::WordBits] >> (endIndex % BitSet::WordBits)) & 1;
     }
 
     std::expected<std::vector<V>, DataStructureError> topologicalSort() const {
+        TRY(sortedIndices, topologicalSortByIndex());
+        std::vector<V> sorted;
+        sorted.reserve(sortedIndices.size());
+        for (size_t index : sortedIndices) sorted.push_back(graph.vertices[index]);
+        return sorted;
+    }
+
+    std::expected<std::vector<size_t>, DataStructureError> topologicalSortByIndex() const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
         if (graph.graphType != GraphType::Directed) return std::unexpected(DataStructureError::InvalidOperation);
-        std::vector<V> sorted;
-        std::vector<size_t> inDegrees;
-        std::queue<V> unvisited;
-        for (V vertex : graph.vertices) {
-            TRY(inDegree, getInDegree(vertex));
-            inDegrees.push_back(inDegree);
-            if (inDegree == 0) unvisited.push(vertex);
-        }
+        if (topologicalOrder.enabled) return topologicalOrder.vertexAt;
+        const size_t vertexCount = graph.vertices.size();
+        std::vector<size_t> sorted;
+        std::vector<size_t> inDegrees(vertexCount, 0);
+        std::queue<size_t> unvisited;
+        for (size_t i = 0; i < vertexCount; i++) forEachNeighbour(i, [&inDegrees](size_t j) { inDegrees[j]++; });
+        for (size_t i = 0; i < vertexCount; i++) if (inDegrees[i] == 0) unvisited.push(i);
         while (!unvisited.empty()) {
-            V vertex = unvisited.front();
+            size_t index = unvisited.front();
             unvisited.pop();
-            sorted.push_back(vertex);
-            TRY(index, findVertexIndex(vertex));
-            for (size_t i = 0; i < graph.vertices.size(); i++) {
-                if (graph.edges[index][i] != E{}) {
-                    inDegrees[i]--;
-                    if (inDegrees[i] == 0) unvisited.push(graph.vertices[i]);
-                }
-            }
+            sorted.push_back(index);
+            forEachNeighbour(index, [&](size_t i) {
+                if (--inDegrees[i] == 0) unvisited.push(i);
+            });
         }
-        if (sorted.size() != graph.vertices.size()) return std::unexpected(DataStructureError::CycleDetected);
+        if (sorted.size() != vertexCount) return std::unexpected(DataStructureError::CycleDetected);
         return sorted;
     }
 
+    // Keeps a topological order up to date from here on: addEdge rejects edges that would close a cycle with CycleDetected,
+    // topologicalSort returns the maintained order and hasCycle is O(1). Fails with CycleDetected if the graph already has a cycle
+    std::expected<void, DataStructureError> enableTopologicalOrder() {
+        if (graph.graphType != GraphType::Directed) return std::unexpected(DataStructureError::InvalidOperation);
+        if (topologicalOrder.enabled) return {};
+        std::vector<size_t> sorted;
+        if (!isEmpty()) {
+            TRY(initial, topologicalSortByIndex());
+            sorted = std::move(initial);
+        }
+        topologicalOrder.position.resize(sorted.size());
+        for (size_t p = 0; p < sorted.size(); p++) topologicalOrder.position[sorted[p]] = p;
+        topologicalOrder.vertexAt = std::move(sorted);
+        topologicalOrder.visited = BitSet(graph.vertices.size());
+        topologicalOrder.enabled = true;
+        return {};
+    }
+
+    void disableTopologicalOrder() { topologicalOrder = TopologicalOrder{}; }
+
+    bool isTopologicalOrderEnabled() const { return topologicalOrder.enabled; }
+
     std::expected<bool, DataStructureError> hasCycle() const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
-        TRY(vertexCount, getVertexCount());
+        if (topologicalOrder.enabled) return false;
+        const size_t vertexCount = graph.vertices.size();
         if (graph.graphType == GraphType::Directed) {
-            UnionFindSet<V> uf(graph.vertices);
-            for (size_t i = 0; i < vertexCount; i++) {
-                for (size_t j = 0; j < vertexCount; j++) {
-                    if (graph.edges[i][j] != E{}) {
-                        TRY(isConnected, uf.isConnected(graph.vertices[i], graph.vertices[j]));
-                        if (isConnected) return true;
-                        TRY(_, uf.unionSet(graph.vertices[i], graph.vertices[j]));
-                    }
-                }
+            for (size_t i = 0; i < vertexCount; i++) if (graph.edges.hasEdge(i, i)) return true;
+            TRY(components, stronglyConnectedComponents());
+            std::vector<bool> seen(vertexCount, false);
+            for (size_t component : components) {
+                if (seen[component]) return true;
+                seen[component] = true;
             }
             return false;
         }
-        else {
-            TRY(_, topologicalSort());
-            return false;
+        DenseUnionFindSet components(vertexCount);
+        for (size_t i = 0; i < vertexCount; i++) {
+            if (graph.edges.hasEdge(i, i)) return true;
+            for (size_t j = graph.edges.nextNeighbour(i, i + 1); j < vertexCount; j = graph.edges.nextNeighbour(i, j + 1)) {
+                if (!components.unite(i, j)) return true;
+            }
         }
+        return false;
     }
 
-    std::expected<std::vector<E>, DataStructureError> Dijkstra(V start) const {
+    // Iterative Tarjan: component id per vertex index, numbered in topological order of the condensation
+    // (every edge between components goes from a lower id to a higher one). Undirected graphs get their connected components
+    std::expected<std::vector<size_t>, DataStructureError> stronglyConnectedComponents() const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        const size_t vertexCount = graph.vertices.size();
+        const size_t unvisited = vertexCount;
+        std::vector<size_t> order(vertexCount, unvisited);
+        std::vector<size_t> low(vertexCount);
+        std::vector<size_t> components(vertexCount);
+        std::vector<size_t> stack;
+        std::vector<std::pair<size_t, size_t>> frames;
+        BitSet onStack(vertexCount);
+        size_t counter = 0;
+        size_t componentCount = 0;
+        auto enter = [&](size_t vertex) {
+            order[vertex] = low[vertex] = counter++;
+            stack.push_back(vertex);
+            onStack.set(vertex);
+            frames.push_back({vertex, 0});
+        };
+        for (size_t root = 0; root < vertexCount; root++) {
+            if (order[root] != unvisited) continue;
+            enter(root);
+            while (!frames.empty()) {
+                const size_t vertex = frames.back().first;
+                const size_t next = graph.edges.nextNeighbour(vertex, frames.back().second);
+                if (next < vertexCount) {
+                    frames.back().second = next + 1;
+                    if (order[next] == unvisited) enter(next);
+                    else if (onStack.test(next)) low[vertex] = std::min(low[vertex], order[next]);
+                    continue;
+                }
+                frames.pop_back();
+                if (!frames.empty()) low[frames.back().first] = std::min(low[frames.back().first], low[vertex]);
+                if (low[vertex] != order[vertex]) continue;
+                size_t member;
+                do {
+                    member = stack.back();
+                    stack.pop_back();
+                    onStack.reset(member);
+                    components[member] = componentCount;
+                } while (member != vertex);
+                componentCount++;
+            }
+        }
+        // Tarjan completes sink components first
+        for (size_t& component : components) component = componentCount - 1 - component;
+        return components;
+    }
+
+    // One vertex per strongly connected component (named by its id); parallel edges between two components keep the smallest weight
+    std::expected<AdjacencyMatrixGraph<size_t, E>, DataStructureError> condensation() const {
         if (graph.graphType != GraphType::Directed) return std::unexpected(DataStructureError::InvalidOperation);
-        TRY(startIndex, findVertexIndex(start));
+        TRY(components, stronglyConnectedComponents());
         const size_t vertexCount = graph.vertices.size();
+        const size_t componentCount = *std::max_element(components.begin(), components.end()) + 1;
+        std::vector<Edge> arcs;
+        for (size_t i = 0; i < vertexCount; i++) {
+            forEachNeighbour(i, [&](size_t j) {
+                if (components[i] != components[j]) arcs.push_back({components[i], components[j], graph.edges.weight(i, j)});
+            });
+        }
+        std::sort(arcs.begin(), arcs.end(), [](const Edge& a, const Edge& b) {
+            if (a.start != b.start) return a.start < b.start;
+            return a.end != b.end ? a.end < b.end : a.weight < b.weight;
+        });
+        AdjacencyMatrixGraph<size_t, E> dag(AdjacencyMatrixGraph<size_t, E>::GraphType::Directed);
+        for (size_t c = 0; c < componentCount; c++) dag.addVertex(c);
+        for (size_t k = 0; k < arcs.size(); k++) {
+            if (k > 0 && arcs[k].start == arcs[k - 1].start && arcs[k].end == arcs[k - 1].end) continue;
+            dag.addEdgeByIndex(arcs[k].start, arcs[k].end, arcs[k].weight);
+        }
+        return dag;
+    }
+
+    std::expected<std::vector<E>, DataStructureError> Dijkstra(V start) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        return DijkstraByIndex(startIndex);
+    }
+
+    std::expected<std::vector<E>, DataStructureError> DijkstraByIndex(size_t startIndex) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (!isValidIndex(startIndex)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        ShortestPathScratch& scratch = threadScratch();
+        scratch.prepare(graph.vertices.size());
+        const uint32_t generation = scratch.generation;
+        Frontier& forward = scratch.forward;
+        startSearch(forward, generation, startIndex, 0);
+        while (!forward.heap.empty()) {
+            size_t current = forward.pop();
+            forward.settled[current] = generation;
+            forEachNeighbour(current, [&](size_t neighbour) {
+                relaxTowards(forward, generation, current, neighbour, graph.edges.weight(current, neighbour), 0);
+            });
+        }
         std::vector<E> distances(graph.vertices.size(), std::numeric_limits<E>::max());
-        std::vector<bool> processed(graph.vertices.size(), false);
-        auto cmp = [&distances](size_t a, size_t b) { return distances[a] > distances[b]; };
-        std::priority_queue<size_t, std::vector<size_t>, decltype(cmp)> unvisited(cmp);
+        for (size_t i = 0; i < graph.vertices.size(); i++) if (forward.settled[i] == generation) distances[i] = forward.distance[i];
+        return distances;
+    }
+
+    std::expected<std::vector<E>, DataStructureError> deltaStepping(V start, ThreadPool& pool, E delta = 0) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        return deltaSteppingByIndex(startIndex, pool, delta);
+    }
+
+    // Parallel SSSP with distance buckets of width delta (0 picks one automatically); same distances as Dijkstra for non-negative weights
+    std::expected<std::vector<E>, DataStructureError> deltaSteppingByIndex(size_t startIndex, ThreadPool& pool, E delta = 0) const {
+        static_assert(std::is_arithmetic_v<E>, "deltaStepping requires an arithmetic edge type");
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (!isValidIndex(startIndex)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        if constexpr (std::is_signed_v<E>) {
+            if (delta < 0) return std::unexpected(DataStructureError::InvalidArgument);
+        }
+        // The weight scan runs even for an explicit delta: a negative edge would make the bucket order meaningless
+        TRY(chosen, chooseDelta());
+        if (delta == 0) delta = chosen;
+        const size_t vertexCount = graph.vertices.size();
+        // Buckets are keyed by floor(distance / delta) and only non-empty ones exist, so memory follows the vertex count
+        // rather than the largest distance over delta
+        const E noBucket = std::numeric_limits<E>::max();
+        std::vector<E> distances(vertexCount, std::numeric_limits<E>::max());
+        std::vector<E> bucketOf(vertexCount, noBucket);
+        std::map<E, std::vector<size_t>> buckets;
+        std::vector<std::vector<size_t>> improved(pool.getThreadCount());
+        auto place = [&](size_t vertex) {
+            E bucket = distances[vertex] / delta;
+            if constexpr (std::is_floating_point_v<E>) bucket = std::floor(bucket);
+            if (bucketOf[vertex] == bucket) return;
+            bucketOf[vertex] = bucket;
+            buckets[bucket].push_back(vertex);
+        };
+        // Relaxes every light (or heavy) edge out of frontier in parallel; distances drop through an atomic min
+        auto relaxEdges = [&](const std::vector<size_t>& frontier, bool light) {
+            pool.parallelFor(0, frontier.size(), [&](size_t begin, size_t end, size_t worker) {
+                for (size_t k = begin; k < end; k++) {
+                    const size_t u = frontier[k];
+                    const E base = std::atomic_ref<E>(distances[u]).load(std::memory_order_relaxed);
+                    forEachNeighbour(u, [&](size_t v) {
+                        const E weight = graph.edges.weight(u, v);
+                        if ((weight <= delta) != light) return;
+                        const E candidate = base + weight;
+                        std::atomic_ref<E> target(distances[v]);
+                        E current = target.load(std::memory_order_relaxed);
+                        while (candidate < current) {
+                            if (target.compare_exchange_weak(current, candidate, std::memory_order_relaxed)) {
+                                improved[worker].push_back(v);
+                                break;
+                            }
+                        }
+                    });
+                }
+            });
+            for (auto& local : improved) {
+                for (size_t v : local) place(v);
+                local.clear();
+            }
+        };
         distances[startIndex] = 0;
-        unvisited.push(startIndex);
-        while (!unvisited.empty()) {
-            size_t current = unvisited.top();
-            unvisited.pop();
-            if (processed[current]) continue;
-            processed[current] = true;
-            for (size_t neighbour = 0; neighbour < vertexCount; neighbour++) {
-                if (graph.edges[current][neighbour] != E{}) {
-                    E newDistance = distances[current] + graph.edges[current][neighbour];
-                    if (newDistance < distances[neighbour]) {
-                        distances[neighbour] = newDistance;
-                        unvisited.push(neighbour);
-                    }
+        place(startIndex);
+        std::vector<size_t> frontier;
+        std::vector<size_t> settled;
+        while (!buckets.empty()) {
+            const auto current = buckets.begin();
+            settled.clear();
+            while (!current->second.empty()) {
+                frontier.clear();
+                for (size_t vertex : current->second) {
+                    if (bucketOf[vertex] != current->first) continue;
+                    bucketOf[vertex] = noBucket;
+                    frontier.push_back(vertex);
                 }
+                current->second.clear();
+                settled.insert(settled.end(), frontier.begin(), frontier.end());
+                relaxEdges(frontier, true);
             }
+            relaxEdges(settled, false);
+            buckets.erase(current);
         }
         return distances;
     }
 
+    std::expected<ShortestPath, DataStructureError> shortestPath(V source, V target, PathSearchMode mode = PathSearchMode::Dijkstra, std::function<E(V)> heuristic = nullptr) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(sourceIndex, findVertexIndex(source));
+        TRY(targetIndex, findVertexIndex(target));
+        thread_local std::vector<size_t> indices;
+        std::function<E(size_t)> indexHeuristic = nullptr;
+        if (heuristic) indexHeuristic = [&](size_t index) { return heuristic(graph.vertices[index]); };
+        TRY(distance, shortestPathByIndex(sourceIndex, targetIndex, indices, mode, indexHeuristic));
+        ShortestPath result{distance, {}};
+        result.path.reserve(indices.size());
+        for (size_t index : indices) result.path.push_back(graph.vertices[index]);
+        return result;
+    }
+
+    std::expected<E, DataStructureError> shortestPathByIndex(size_t source, size_t target, std::vector<size_t>& path, PathSearchMode mode = PathSearchMode::Dijkstra, const std::function<E(size_t)>& heuristic = nullptr) const {
+        return shortestPathByIndex(source, target, path, threadScratch(), mode, heuristic);
+    }
+
+    // s-t query that stops once target is settled (or the two searches meet); path receives source..target.
+    // AStar needs a consistent heuristic (a lower bound on the remaining distance); weights must be non-negative.
+    std::expected<E, DataStructureError> shortestPathByIndex(size_t source, size_t target, std::vector<size_t>& path, ShortestPathScratch& scratch, PathSearchMode mode = PathSearchMode::Dijkstra, const std::function<E(size_t)>& heuristic = nullptr) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (!isValidIndex(source) || !isValidIndex(target)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        if (mode == PathSearchMode::AStar && !heuristic) return std::unexpected(DataStructureError::InvalidArgument);
+        scratch.prepare(graph.vertices.size());
+        path.clear();
+        if (mode == PathSearchMode::Bidirectional) return bidirectionalSearch(source, target, path, scratch);
+        const uint32_t generation = scratch.generation;
+        Frontier& forward = scratch.forward;
+        const bool guided = mode == PathSearchMode::AStar;
+        startSearch(forward, generation, source, guided ? heuristic(source) : 0);
+        while (!forward.heap.empty()) {
+            size_t u = forward.pop();
+            forward.settled[u] = generation;
+            if (u == target) {
+                appendChain(forward, target, path);
+                std::reverse(path.begin(), path.end());
+                return forward.distance[target];
+            }
+            forEachNeighbour(u, [&](size_t v) {
+                if (forward.settled[v] == generation) return;
+                relaxTowards(forward, generation, u, v, graph.edges.weight(u, v), guided ? heuristic(v) : 0);
+            });
+        }
+        return std::unexpected(DataStructureError::ElementNotFound);
+    }
+
     std::expected<std::vector<std::vector<E>>, DataStructureError> floyd() const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
         TRY(vertexCount, getVertexCount());
@@ -312,7 +1437,7 @@ public:
         for (size_t i = 0; i < vertexCount; i++) {
             for (size_t j = 0; j < vertexCount; j++) {
                 if (i == j) distances[i][j] = 0;
-                else if (graph.edges[i][j] != E{}) distances[i][j] = graph.edges[i][j];
+                else if (graph.edges.hasEdge(i, j)) distances[i][j] = graph.edges.weight(i, j);
                 else distances[i][j] = std::numeric_limits<E>::max();
             }
         }
@@ -327,28 +1452,131 @@ public:
         }
         return distances;
     }
-    
+
+    std::expected<std::vector<E>, DataStructureError> floydBlocked() const {
+        ThreadPool pool(1);
+        return floydBlocked(pool);
+    }
+
+    // Tiled Floyd-Warshall over one contiguous row-major V x V buffer; unreachable pairs hold numeric_limits<E>::max() as in floyd()
+    std::expected<std::vector<E>, DataStructureError> floydBlocked(ThreadPool& pool) const {
+        static_assert(std::is_arithmetic_v<E> && !std::is_same_v<E, bool>, "floydBlocked requires a numeric edge type");
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        const size_t vertexCount = graph.vertices.size();
+        const size_t tileCount = (vertexCount + FloydTileSize - 1) / FloydTileSize;
+        const size_t stride = tileCount * FloydTileSize;
+        const E infinity = std::numeric_limits<E>::has_infinity ? std::numeric_limits<E>::infinity() : std::numeric_limits<E>::max();
+        std::vector<E> distances(stride * stride, infinity);
+        for (size_t i = 0; i < vertexCount; i++) {
+            forEachNeighbour(i, [&](size_t j) { distances[i * stride + j] = graph.edges.weight(i, j); });
+            distances[i * stride + i] = 0;
+        }
+        auto tile = [&](size_t row, size_t column) { return distances.data() + row * FloydTileSize * stride + column * FloydTileSize; };
+        for (size_t k = 0; k < tileCount; k++) {
+            floydTile(tile(k, k), tile(k, k), tile(k, k), stride);
+            pool.parallelFor(0, tileCount, [&](size_t begin, size_t end, size_t) {
+                for (size_t t = begin; t < end; t++) {
+                    if (t == k) continue;
+                    floydTile(tile(k, t), tile(k, k), tile(k, t), stride);
+                    floydTile(tile(t, k), tile(t, k), tile(k, k), stride);
+                }
+            }, 1);
+            pool.parallelFor(0, tileCount * tileCount, [&](size_t begin, size_t end, size_t) {
+                for (size_t t = begin; t < end; t++) {
+                    size_t row = t / tileCount, column = t % tileCount;
+                    if (row == k || column == k) continue;
+                    floydTile(tile(row, column), tile(row, k), tile(k, column), stride);
+                }
+            }, 1);
+        }
+        std::vector<E> result(vertexCount * vertexCount);
+        for (size_t i = 0; i < vertexCount; i++) {
+            for (size_t j = 0; j < vertexCount; j++) {
+                E distance = distances[i * stride + j];
+                result[i * vertexCount + j] = distance == infinity ? std::numeric_limits<E>::max() : distance;
+            }
+        }
+        return result;
+    }
+
     std::expected<bool, DataStructureError> isConnected() const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
-        V start = graph.vertices[0];
-        size_t visitedCount = 0;
-        auto result = BFS(start, [&visitedCount](V vertex) { visitedCount++; });
-        TRY(vertexCount, getVertexCount());
-        return visitedCount == vertexCount;
+        if (connectivity.enabled) return connectivity.components.getSetCount() == 1;
+        TRY(order, BFSByIndex(0));
+        return order.size() == graph.vertices.size();
     }
 
-    std::expected<Graph, DataStructureError> primMST(V start) const {
+    std::expected<bool, DataStructureError> isConnected(ThreadPool& pool) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (connectivity.enabled) return connectivity.components.getSetCount() == 1;
+        return parallelBFS(0, pool, false, graph.vertices.size()).size() == graph.vertices.size();
+    }
+
+    // Component id per vertex index, numbered in order of each component's first vertex: rows are scanned in parallel and
+    // every edge unites its ends in a shared concurrent union-find. Directed graphs get their weakly connected components
+    std::expected<std::vector<size_t>, DataStructureError> connectedComponents(ThreadPool& pool) const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        const bool undirected = graph.graphType == GraphType::Undirected;
+        ConcurrentUnionFindSet components(graph.vertices.size());
+        pool.parallelFor(0, graph.vertices.size(), [&](size_t begin, size_t end, size_t) {
+            for (size_t u = begin; u < end; u++) {
+                forEachNeighbour(u, [&](size_t v) {
+                    if (!undirected || u < v) components.unite(u, v);
+                });
+            }
+        });
+        return components.labels(pool);
+    }
+
+    // Streaming connectivity for undirected graphs: addEdge merges components in near-constant time, removeEdge searches
+    // only until its endpoints meet again and splits a component only for a bridge. While enabled, hasPath, isConnected
+    // and the component queries below answer from the union-find instead of a traversal
+    std::expected<void, DataStructureError> enableIncrementalConnectivity() {
         if (graph.graphType != GraphType::Undirected) return std::unexpected(DataStructureError::InvalidOperation);
+        if (connectivity.enabled) return {};
+        rebuildConnectivity();
+        connectivity.enabled = true;
+        return {};
+    }
+
+    void disableIncrementalConnectivity() { connectivity = ConnectivityIndex{}; }
+
+    bool isIncrementalConnectivityEnabled() const { return connectivity.enabled; }
+
+    std::expected<size_t, DataStructureError> getComponentCount() const {
+        if (!connectivity.enabled) return std::unexpected(DataStructureError::InvalidOperation);
+        return connectivity.components.getSetCount();
+    }
+
+    std::expected<size_t, DataStructureError> getComponentSize(V vertex) const {
+        TRY(index, findVertexIndex(vertex));
+        return getComponentSizeByIndex(index);
+    }
+
+    std::expected<size_t, DataStructureError> getComponentSizeByIndex(size_t index) const {
+        if (!connectivity.enabled) return std::unexpected(DataStructureError::InvalidOperation);
+        if (!isValidIndex(index)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        return connectivity.components.setSize(index);
+    }
+
+    std::expected<Graph, DataStructureError> primMST(V start) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
         TRY(startIndex, findVertexIndex(start));
-        TRY(vertexCount, getVertexCount());
+        return primMSTByIndex(startIndex);
+    }
+
+    std::expected<Graph, DataStructureError> primMSTByIndex(size_t startIndex) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (graph.graphType != GraphType::Undirected) return std::unexpected(DataStructureError::InvalidOperation);
+        if (!isValidIndex(startIndex)) return std::unexpected(DataStructureError::IndexOutOfRange);
+        const size_t vertexCount = graph.vertices.size();
         Graph mst;
         mst.graphType = GraphType::Undirected;
         mst.vertices = graph.vertices;
-        mst.edges = std::vector<std::vector<E>>(graph.vertices.size(), std::vector<E>(graph.vertices.size(), E{}));
+        mst.edges = EdgeMatrix<E>(graph.vertices.size());
         std::vector<bool> inMST(vertexCount, false);
         std::vector<E> minEdge(vertexCount, std::numeric_limits<E>::max());
-        std::vector<V> parent(vertexCount, std::numeric_limits<V>::max());
+        std::vector<size_t> parent(vertexCount, vertexCount);
         minEdge[startIndex] = 0;
         for (size_t i = 0; i < vertexCount; i++) {
             size_t u = vertexCount;
@@ -361,18 +1589,17 @@ public:
             }
             if (u == vertexCount) return std::unexpected(DataStructureError::InvalidOperation);
             inMST[u] = true;
-            for (size_t v = 0; v < vertexCount; v++) {
-                if (graph.edges[u][v] != E{} && !inMST[v] && graph.edges[u][v] < minEdge[v]) {
-                    minEdge[v] = graph.edges[u][v];
-                    parent[v] = graph.vertices[u];
+            forEachNeighbour(u, [&](size_t v) {
+                if (!inMST[v] && graph.edges.weight(u, v) < minEdge[v]) {
+                    minEdge[v] = graph.edges.weight(u, v);
+                    parent[v] = u;
                 }
-            }
+            });
         }
         for (size_t i = 0; i < vertexCount; i++) {
-            if (parent[i] != std::numeric_limits<V>::max()) {
-                TRY(parentIndex, findVertexIndex(parent[i]));
-                mst.edges[parentIndex][i] = minEdge[i];
-                mst.edges[i][parentIndex] = minEdge[i];
+            if (parent[i] != vertexCount) {
+                mst.edges.setEdge(parent[i], i, minEdge[i]);
+                mst.edges.setEdge(i, parent[i], minEdge[i]);
             }
         }
         return mst;
@@ -384,37 +1611,164 @@ public:
         std::vector<Edge> allEdges;
         TRY(vertexCount, getVertexCount());
         for (size_t i = 0; i < vertexCount; i++) {
-            for (size_t j = i + 1; j < vertexCount; j++) {
-                if (graph.edges[i][j] != E{}) allEdges.push_back({i, j, graph.edges[i][j]});
-            }
+            for (size_t j = graph.edges.nextNeighbour(i, i + 1); j < vertexCount; j = graph.edges.nextNeighbour(i, j + 1)) allEdges.push_back({i, j, graph.edges.weight(i, j)});
         }
-        std::sort(allEdges.begin(), allEdges.end(), [](const Edge& a, const Edge& b) { return a.weight < b.weight; });
-        UnionFindSet<V> uf(graph.vertices);
+        std::sort(allEdges.begin(), allEdges.end(), lighterEdge);
+        DenseUnionFindSet components(vertexCount);
         Graph mst;
         mst.graphType = GraphType::Undirected;
         mst.vertices = graph.vertices;
-        mst.edges = std::vector<std::vector<E>>(graph.vertices.size(), std::vector<E>(graph.vertices.size(), E{}));
-        int edgesAdded = 0;
-        int requiredEdges = vertexCount - 1;
+        mst.edges = EdgeMatrix<E>(graph.vertices.size());
+        size_t edgesAdded = 0;
         for (const auto& edge : allEdges) {
-            V startVertex = graph.vertices[edge.start];
-            V endVertex = graph.vertices[edge.end];
-            TRY(isConnected, uf.isConnected(startVertex, endVertex));
-            if (!isConnected) {
-                auto unionResult = uf.unionSet(startVertex, endVertex);
-                if (!unionResult.has_value()) return std::unexpected(unionResult.error());
-                TRY(startIndex, findVertexIndex(startVertex));
-                TRY(endIndex, findVertexIndex(endVertex));
-                mst.edges[startIndex][endIndex] = edge.weight;
-                mst.edges[endIndex][startIndex] = edge.weight;
-                edgesAdded++;
-                if (edgesAdded == requiredEdges) break;
-            }
-        }
-        if (edgesAdded != requiredEdges) return std::unexpected(DataStructureError::InvalidOperation);
+            if (edgesAdded + 1 == vertexCount) break;
+            if (!components.unite(edge.start, edge.end)) continue;
+            mst.edges.setEdge(edge.start, edge.end, edge.weight);
+            mst.edges.setEdge(edge.end, edge.start, edge.weight);
+            edgesAdded++;
+        }
+        if (edgesAdded + 1 != vertexCount) return std::unexpected(DataStructureError::InvalidOperation);
         return mst;
     }
 
+    // Parallel Boruvka: every round each vertex scans its row for the lightest edge leaving its component, each component keeps
+    // the lightest of those, and the chosen edges are united in parallel in a concurrent union-find. Returns the V - 1 tree edges
+    std::expected<std::vector<Edge>, DataStructureError> boruvkaMST(ThreadPool& pool) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (graph.graphType != GraphType::Undirected) return std::unexpected(DataStructureError::InvalidOperation);
+        const size_t vertexCount = graph.vertices.size();
+        const size_t none = vertexCount;
+        std::vector<size_t> component(vertexCount);
+        std::iota(component.begin(), component.end(), 0);
+        std::vector<Edge> cheapest(vertexCount);
+        std::vector<size_t> chosen(vertexCount);
+        std::vector<uint8_t> merged(vertexCount);
+        ConcurrentUnionFindSet components(vertexCount);
+        std::vector<Edge> forest;
+        forest.reserve(vertexCount - 1);
+        while (forest.size() + 1 < vertexCount) {
+            pool.parallelFor(0, vertexCount, [&](size_t begin, size_t end, size_t) {
+                for (size_t u = begin; u < end; u++) {
+                    Edge best{none, none, E{}};
+                    forEachNeighbour(u, [&](size_t v) {
+                        if (component[v] == component[u]) return;
+                        Edge candidate{std::min(u, v), std::max(u, v), graph.edges.weight(u, v)};
+                        if (best.start == none || lighterEdge(candidate, best)) best = candidate;
+                    });
+                    cheapest[u] = best;
+                }
+            });
+            std::fill(chosen.begin(), chosen.end(), none);
+            for (size_t u = 0; u < vertexCount; u++) {
+                if (cheapest[u].start == none) continue;
+                size_t& current = chosen[component[u]];
+                if (current == none || lighterEdge(cheapest[u], cheapest[current])) current = u;
+            }
+            // With a strict edge order all chosen edges belong to the MST, so they never close a cycle and each distinct edge
+            // wins exactly one unite, even when both of its components chose it
+            pool.parallelFor(0, vertexCount, [&](size_t begin, size_t end, size_t) {
+                for (size_t c = begin; c < end; c++) {
+                    merged[c] = chosen[c] != none && components.unite(cheapest[chosen[c]].start, cheapest[chosen[c]].end);
+                }
+            });
+            const size_t before = forest.size();
+            for (size_t c = 0; c < vertexCount; c++) if (merged[c]) forest.push_back(cheapest[chosen[c]]);
+            if (forest.size() == before) return std::unexpected(DataStructureError::InvalidOperation);
+            pool.parallelFor(0, vertexCount, [&](size_t begin, size_t end, size_t) {
+                for (size_t u = begin; u < end; u++) component[u] = components.find(u);
+            });
+        }
+        return forest;
+    }
+
+    // Filter-Kruskal over an edge list gathered in parallel; returns the V - 1 tree edges
+    std::expected<std::vector<Edge>, DataStructureError> filterKruskalMST(ThreadPool& pool) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (graph.graphType != GraphType::Undirected) return std::unexpected(DataStructureError::InvalidOperation);
+        const size_t vertexCount = graph.vertices.size();
+        std::vector<Edge> edges = collectUndirectedEdges(pool);
+        DenseUnionFindSet components(vertexCount);
+        std::vector<Edge> forest;
+        forest.reserve(vertexCount - 1);
+        filterKruskal(edges, 0, edges.size(), components, forest, pool);
+        if (forest.size() + 1 != vertexCount) return std::unexpected(DataStructureError::InvalidOperation);
+        return forest;
+    }
+
+    std::expected<LocalityStats, DataStructureError> getLocalityStats() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        const size_t vertexCount = graph.vertices.size();
+        const size_t usedWords = (vertexCount + EdgePresenceMatrix::WordBits - 1) / EdgePresenceMatrix::WordBits;
+        LocalityStats stats{0, 0, 0.0, 0};
+        size_t gapSum = 0;
+        size_t edgeCount = 0;
+        for (size_t i = 0; i < vertexCount; i++) {
+            const uint64_t* words = graph.edges.presenceRow(i);
+            for (size_t w = 0; w < usedWords; w++) stats.occupiedWords += words[w] != 0;
+            const size_t lowest = graph.edges.nextNeighbour(i, 0);
+            if (lowest < i) stats.profile += i - lowest;
+            forEachNeighbour(i, [&](size_t j) {
+                const size_t gap = i > j ? i - j : j - i;
+                stats.bandwidth = std::max(stats.bandwidth, gap);
+                gapSum += gap;
+                edgeCount++;
+            });
+        }
+        if (edgeCount != 0) stats.averageGap = static_cast<double>(gapSum) / static_cast<double>(edgeCount);
+        return stats;
+    }
+
+    // Permutation for reorderVertices / permuteVertices: entry i is the current index of the vertex that should move to index i
+    std::expected<std::vector<size_t>, DataStructureError> computeVertexOrdering(VertexOrdering ordering) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        std::vector<size_t> offsets;
+        std::vector<size_t> targets;
+        symmetricAdjacency(offsets, targets);
+        if (ordering != VertexOrdering::DegreeDescending) return breadthFirstOrdering(offsets, targets, ordering == VertexOrdering::ReverseCuthillMcKee);
+        std::vector<size_t> order(graph.vertices.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return offsets[a + 1] - offsets[a] > offsets[b + 1] - offsets[b]; });
+        return order;
+    }
+
+    // Relabels the stored graph: vertex order[i] moves to index i, rows and columns of the matrix included. Vertex values
+    // travel with their rows, so value-based calls are unaffected; index-based results follow the new numbering
+    std::expected<void, DataStructureError> permuteVertices(const std::vector<size_t>& order) {
+        const size_t vertexCount = graph.vertices.size();
+        if (order.size() != vertexCount) return std::unexpected(DataStructureError::InvalidArgument);
+        BitSet seen(vertexCount);
+        for (size_t index : order) {
+            if (!isValidIndex(index) || seen.test(index)) return std::unexpected(DataStructureError::InvalidArgument);
+            seen.set(index);
+        }
+        std::vector<V> vertices;
+        vertices.reserve(vertexCount);
+        for (size_t index : order) vertices.push_back(std::move(graph.vertices[index]));
+        graph.vertices.swap(vertices);
+        for (size_t i = 0; i < vertexCount; i++) vertexIndex[graph.vertices[i]] = i;
+        graph.edges.permute(order);
+        reachability.valid = false;
+        if (topologicalOrder.enabled) {
+            std::vector<size_t> position(vertexCount);
+            for (size_t i = 0; i < vertexCount; i++) position[i] = topologicalOrder.position[order[i]];
+            topologicalOrder.position.swap(position);
+            for (size_t i = 0; i < vertexCount; i++) topologicalOrder.vertexAt[topologicalOrder.position[i]] = i;
+        }
+        if (connectivity.enabled) rebuildConnectivity();
+        return {};
+    }
+
+    // Renumbers vertices for cache locality (neighbours of a vertex land in nearby rows and presence words) and reports
+    // bandwidth / locality before and after. Every algorithm then runs on the new layout without further changes
+    std::expected<Reordering, DataStructureError> reorderVertices(VertexOrdering ordering) {
+        TRY(before, getLocalityStats());
+        TRY(order, computeVertexOrdering(ordering));
+        auto permuted = permuteVertices(order);
+        if (!permuted) return std::unexpected(permuted.error());
+        TRY(after, getLocalityStats());
+        return Reordering{std::move(order), before, after};
+    }
+
     std::expected<void, DataStructureError> printAdjacencyMatrixGraph() const {
         if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
         Graph printGraph;
@@ -425,15 +1779,30 @@ public:
         std::cout << "Edges:" << std::endl;
         for (size_t i = 0; i < graph.vertices.size(); i++) {
             for (size_t j = 0; j < graph.vertices.size(); j++) {
-                std::cout << graph.edges[i][j] << " ";
+                std::cout << graph.edges.weight(i, j) << " ";
             }
             std::cout << std::endl;
         }
         return {};
     }
 
+    void shrinkToFit() {
+        graph.vertices.shrink_to_fit();
+        graph.edges.shrinkToFit();
+    }
+
     void clear() {
         graph.vertices.clear();
         graph.edges.clear();
+        vertexIndex.clear();
+        reachability = ReachabilityIndex{};
+        if (topologicalOrder.enabled) {
+            topologicalOrder = TopologicalOrder{};
+            topologicalOrder.enabled = true;
+        }
+        if (connectivity.enabled) {
+            connectivity = ConnectivityIndex{};
+            connectivity.enabled = true;
+        }
     }
 };
\ No newline at end of file
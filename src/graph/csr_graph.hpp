@@ -0,0 +1,421 @@
+#pragma once
+#include <iostream>
+#include <functional>
+#include <vector>
+#include <queue>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include <unordered_map>
+#include "adjacency_matrix_graph.hpp"
+#include "csr_view.hpp"
+#include "../set/union_find_set.hpp"
+#include "../error/error.hpp"
+
+// Compressed sparse row graph: row i owns targets[offsets[i] .. offsets[i + 1]), sorted by target index
+template<typename V, typename E>
+class CSRGraph {
+public:
+    using GraphType = typename AdjacencyMatrixGraph<V, E>::GraphType;
+    using Edge = typename AdjacencyMatrixGraph<V, E>::Edge;
+    struct Graph {
+        std::vector<V> vertices;
+        std::vector<size_t> offsets;
+        std::vector<size_t> targets;
+        std::vector<E> weights;
+        GraphType graphType;
+    };
+
+protected:
+    Graph graph;
+    std::vector<size_t> inDegrees;
+    std::unordered_map<V, size_t> vertexIndex;
+
+    std::expected<size_t, DataStructureError> findVertexIndex(V vertex) const {
+        auto it = vertexIndex.find(vertex);
+        if (it == vertexIndex.end()) return std::unexpected(DataStructureError::ElementNotFound);
+        return it->second;
+    }
+
+    using Matrix = AdjacencyMatrixGraph<V, E>;
+    using Frontier = typename Matrix::ShortestPathScratch::Frontier;
+
+    // Two stable counting passes (by target, then by source) leave every row sorted by target in O(V + E). position maps
+    // the vertex positions edges were given in onto the deduplicated table; edges past its end are skipped
+    void buildFromEdges(const std::vector<Edge>& edges, const std::vector<size_t>& position) {
+        const size_t vertexCount = graph.vertices.size();
+        std::vector<Edge> arcs;
+        arcs.reserve(graph.graphType == GraphType::Undirected ? edges.size() * 2 : edges.size());
+        for (const auto& edge : edges) {
+            if (edge.start >= position.size() || edge.end >= position.size()) continue;
+            const size_t start = position[edge.start];
+            const size_t end = position[edge.end];
+            arcs.push_back({start, end, edge.weight});
+            if (graph.graphType == GraphType::Undirected && start != end) arcs.push_back({end, start, edge.weight});
+        }
+        auto countingSort = [vertexCount](std::vector<Edge>& items, auto key) {
+            std::vector<size_t> bucket(vertexCount + 1, 0);
+            for (const auto& item : items) bucket[key(item) + 1]++;
+            for (size_t i = 0; i < vertexCount; i++) bucket[i + 1] += bucket[i];
+            std::vector<Edge> sorted(items.size());
+            for (const auto& item : items) sorted[bucket[key(item)]++] = item;
+            items.swap(sorted);
+        };
+        countingSort(arcs, [](const Edge& edge) { return edge.end; });
+        countingSort(arcs, [](const Edge& edge) { return edge.start; });
+        graph.offsets.assign(vertexCount + 1, 0);
+        graph.targets.clear();
+        graph.weights.clear();
+        graph.targets.reserve(arcs.size());
+        graph.weights.reserve(arcs.size());
+        for (size_t i = 0; i < arcs.size(); i++) {
+            if (i > 0 && arcs[i].start == arcs[i - 1].start && arcs[i].end == arcs[i - 1].end) continue;
+            graph.offsets[arcs[i].start + 1]++;
+            graph.targets.push_back(arcs[i].end);
+            graph.weights.push_back(arcs[i].weight);
+        }
+        for (size_t i = 0; i < vertexCount; i++) graph.offsets[i + 1] += graph.offsets[i];
+        buildInDegrees();
+    }
+
+    void buildInDegrees() {
+        inDegrees.assign(graph.vertices.size(), 0);
+        for (size_t target : graph.targets) inDegrees[target]++;
+    }
+
+    // Reads the matrix presence bits in place: popcount to size the rows, one pass to fill them, no intermediate edge list
+    void buildFromMatrix(const typename AdjacencyMatrixGraph<V, E>::Graph& matrix) {
+        const size_t vertexCount = graph.vertices.size();
+        graph.offsets.assign(vertexCount + 1, 0);
+        for (size_t i = 0; i < vertexCount; i++) graph.offsets[i + 1] = graph.offsets[i] + matrix.edges.rowDegree(i);
+        graph.targets.resize(graph.offsets[vertexCount]);
+        graph.weights.resize(graph.offsets[vertexCount]);
+        for (size_t i = 0; i < vertexCount; i++) {
+            size_t position = graph.offsets[i];
+            matrix.edges.forEachNeighbour(i, [&](size_t j) {
+                graph.targets[position] = j;
+                graph.weights[position] = matrix.edges.weight(i, j);
+                position++;
+            });
+        }
+        buildInDegrees();
+    }
+
+    // std::vector<bool> has no contiguous storage to view, so an unweighted graph exposes its structure only
+    CSRView<V, E> view() const {
+        if constexpr (std::is_same_v<E, bool>) return {graph.vertices, graph.offsets, graph.targets, {}};
+        else return {graph.vertices, graph.offsets, graph.targets, graph.weights};
+    }
+
+    std::expected<size_t, DataStructureError> findEdgePosition(size_t startIndex, size_t endIndex) const {
+        return view().findEdgePosition(startIndex, endIndex);
+    }
+
+public:
+    explicit CSRGraph(GraphType type = GraphType::Directed) : graph{.vertices = {}, .offsets = {0}, .targets = {}, .weights = {}, .graphType = type} {}
+
+    // Edge::start / Edge::end are indices into vertices; undirected edges are listed once and mirrored. As in the bulk
+    // AdjacencyMatrixGraph constructor a repeated vertex collapses onto its first occurrence and out-of-range edges are skipped
+    CSRGraph(std::vector<V> vertices, const std::vector<Edge>& edges, GraphType type = GraphType::Directed) : graph{.vertices = {}, .offsets = {}, .targets = {}, .weights = {}, .graphType = type} {
+        const std::vector<size_t> position = Matrix::deduplicateVertices(vertices, graph.vertices, vertexIndex);
+        buildFromEdges(edges, position);
+    }
+
+    // The matrix graph's vertex table is already unique, so its index is reused as is
+    explicit CSRGraph(const AdjacencyMatrixGraph<V, E>& matrixGraph) : graph{.vertices = matrixGraph.graph.vertices, .offsets = {}, .targets = {}, .weights = {}, .graphType = matrixGraph.graph.graphType}, vertexIndex(matrixGraph.vertexIndex) {
+        buildFromMatrix(matrixGraph.graph);
+    }
+
+    // Takes over the vertex table of the matrix graph instead of copying it and releases the matrix afterwards
+    explicit CSRGraph(AdjacencyMatrixGraph<V, E>&& matrixGraph) : graph{.vertices = std::move(matrixGraph.graph.vertices), .offsets = {}, .targets = {}, .weights = {}, .graphType = matrixGraph.graph.graphType}, vertexIndex(std::move(matrixGraph.vertexIndex)) {
+        buildFromMatrix(matrixGraph.graph);
+        matrixGraph.clear();
+    }
+
+    ~CSRGraph() = default;
+
+    bool isEmpty() const { return graph.vertices.empty(); }
+
+    const Graph& getGraph() const { return graph; }
+
+    bool hasVertex(V vertex) const { return findVertexIndex(vertex).has_value(); }
+
+    bool hasEdge(V start, V end) const {
+        auto startIndex = findVertexIndex(start);
+        auto endIndex = findVertexIndex(end);
+        if (!startIndex || !endIndex) return false;
+        return findEdgePosition(*startIndex, *endIndex).has_value();
+    }
+
+    std::expected<E, DataStructureError> getEdge(V start, V end) const {
+        TRY(startIndex, findVertexIndex(start));
+        TRY(endIndex, findVertexIndex(end));
+        TRY(position, findEdgePosition(startIndex, endIndex));
+        return graph.weights[position];
+    }
+
+    std::expected<std::vector<V>, DataStructureError> getVertices(std::function<void(V)> visitor) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        for (const auto& vertex : graph.vertices) visitor(vertex);
+        return graph.vertices;
+    }
+
+    std::expected<std::vector<V>, DataStructureError> getNeighbours(V vertex, std::function<void(V)> visitor) const {
+        TRY(index, findVertexIndex(vertex));
+        return view().neighbours(index, visitor);
+    }
+
+    std::expected<size_t, DataStructureError> getDegree(V vertex) const {
+        TRY(index, findVertexIndex(vertex));
+        size_t outDegree = graph.offsets[index + 1] - graph.offsets[index];
+        if (graph.graphType == GraphType::Undirected) return outDegree;
+        return outDegree + inDegrees[index];
+    }
+
+    std::expected<size_t, DataStructureError> getInDegree(V vertex) const {
+        TRY(index, findVertexIndex(vertex));
+        return inDegrees[index];
+    }
+
+    std::expected<size_t, DataStructureError> getOutDegree(V vertex) const {
+        TRY(index, findVertexIndex(vertex));
+        return graph.offsets[index + 1] - graph.offsets[index];
+    }
+
+    std::expected<size_t, DataStructureError> getVertexCount() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        return graph.vertices.size();
+    }
+
+    std::expected<size_t, DataStructureError> getEdgeCount() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        return graph.targets.size();
+    }
+
+    std::expected<std::vector<V>, DataStructureError> DFSRecursive(V start, std::function<void(V)> visitor) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        return view().DFSRecursive(startIndex, visitor);
+    }
+
+    std::expected<std::vector<V>, DataStructureError> DFSIterative(V start, std::function<void(V)> visitor) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        return view().DFSIterative(startIndex, visitor);
+    }
+
+    std::expected<std::vector<V>, DataStructureError> BFS(V start, std::function<void(V)> visitor) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        return view().BFS(startIndex, visitor);
+    }
+
+    std::expected<bool, DataStructureError> hasPath(V start, V end) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        TRY(endIndex, findVertexIndex(end));
+        return view().hasPath(startIndex, endIndex);
+    }
+
+    std::expected<std::vector<V>, DataStructureError> topologicalSort() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (graph.graphType != GraphType::Directed) return std::unexpected(DataStructureError::InvalidOperation);
+        std::vector<V> sorted;
+        std::vector<size_t> remaining = inDegrees;
+        std::queue<size_t> unvisited;
+        for (size_t i = 0; i < graph.vertices.size(); i++) if (remaining[i] == 0) unvisited.push(i);
+        while (!unvisited.empty()) {
+            size_t index = unvisited.front();
+            unvisited.pop();
+            sorted.push_back(graph.vertices[index]);
+            for (size_t i = graph.offsets[index]; i < graph.offsets[index + 1]; i++) {
+                if (--remaining[graph.targets[i]] == 0) unvisited.push(graph.targets[i]);
+            }
+        }
+        if (sorted.size() != graph.vertices.size()) return std::unexpected(DataStructureError::CycleDetected);
+        return sorted;
+    }
+
+    std::expected<bool, DataStructureError> hasCycle() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (graph.graphType == GraphType::Directed) {
+            auto sorted = topologicalSort();
+            if (sorted.has_value()) return false;
+            if (sorted.error() == DataStructureError::CycleDetected) return true;
+            return std::unexpected(sorted.error());
+        }
+        DenseUnionFindSet components(graph.vertices.size());
+        for (size_t i = 0; i < graph.vertices.size(); i++) {
+            for (size_t k = graph.offsets[i]; k < graph.offsets[i + 1]; k++) {
+                size_t j = graph.targets[k];
+                if (j < i) continue;
+                if (j == i || !components.unite(i, j)) return true;
+            }
+        }
+        return false;
+    }
+
+    // Iterative Tarjan over the row cursors, so deep graphs cannot overflow the call stack. Component ids are numbered in
+    // topological order of the condensation (every edge between components goes from a lower id to a higher one)
+    std::expected<std::vector<size_t>, DataStructureError> stronglyConnectedComponents() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        const size_t vertexCount = graph.vertices.size();
+        const size_t unvisited = vertexCount;
+        std::vector<size_t> order(vertexCount, unvisited);
+        std::vector<size_t> low(vertexCount);
+        std::vector<size_t> components(vertexCount);
+        std::vector<bool> onStack(vertexCount, false);
+        std::vector<size_t> stack;
+        std::vector<std::pair<size_t, size_t>> frames;
+        size_t counter = 0;
+        size_t componentCount = 0;
+        auto enter = [&](size_t vertex) {
+            order[vertex] = low[vertex] = counter++;
+            stack.push_back(vertex);
+            onStack[vertex] = true;
+            frames.push_back({vertex, graph.offsets[vertex]});
+        };
+        for (size_t root = 0; root < vertexCount; root++) {
+            if (order[root] != unvisited) continue;
+            enter(root);
+            while (!frames.empty()) {
+                auto [vertex, cursor] = frames.back();
+                if (cursor < graph.offsets[vertex + 1]) {
+                    frames.back().second++;
+                    size_t next = graph.targets[cursor];
+                    if (order[next] == unvisited) enter(next);
+                    else if (onStack[next]) low[vertex] = std::min(low[vertex], order[next]);
+                    continue;
+                }
+                frames.pop_back();
+                if (!frames.empty()) low[frames.back().first] = std::min(low[frames.back().first], low[vertex]);
+                if (low[vertex] != order[vertex]) continue;
+                size_t member;
+                do {
+                    member = stack.back();
+                    stack.pop_back();
+                    onStack[member] = false;
+                    components[member] = componentCount;
+                } while (member != vertex);
+                componentCount++;
+            }
+        }
+        for (size_t& component : components) component = componentCount - 1 - component;
+        return components;
+    }
+
+    // DAG with one vertex per strongly connected component (named by its id); parallel edges keep the smallest weight
+    std::expected<CSRGraph<size_t, E>, DataStructureError> condensation() const {
+        if (graph.graphType != GraphType::Directed) return std::unexpected(DataStructureError::InvalidOperation);
+        TRY(components, stronglyConnectedComponents());
+        using Arc = typename CSRGraph<size_t, E>::Edge;
+        const size_t componentCount = *std::max_element(components.begin(), components.end()) + 1;
+        std::vector<Arc> arcs;
+        for (size_t i = 0; i < graph.vertices.size(); i++) {
+            for (size_t k = graph.offsets[i]; k < graph.offsets[i + 1]; k++) {
+                size_t j = graph.targets[k];
+                if (components[i] != components[j]) arcs.push_back({components[i], components[j], graph.weights[k]});
+            }
+        }
+        std::sort(arcs.begin(), arcs.end(), [](const Arc& a, const Arc& b) {
+            if (a.start != b.start) return a.start < b.start;
+            return a.end != b.end ? a.end < b.end : a.weight < b.weight;
+        });
+        std::vector<size_t> ids(componentCount);
+        std::iota(ids.begin(), ids.end(), 0);
+        return CSRGraph<size_t, E>(std::move(ids), arcs, CSRGraph<size_t, E>::GraphType::Directed);
+    }
+
+    std::expected<std::vector<E>, DataStructureError> Dijkstra(V start) const {
+        static_assert(!std::is_same_v<E, bool>, "Dijkstra needs numeric weights; BFS gives hop distances of an unweighted graph");
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        return view().Dijkstra(startIndex);
+    }
+
+    std::expected<bool, DataStructureError> isConnected() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(visited, BFS(graph.vertices[0], [](V) {}));
+        return visited.size() == graph.vertices.size();
+    }
+
+    std::expected<CSRGraph, DataStructureError> primMST(V start) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (graph.graphType != GraphType::Undirected) return std::unexpected(DataStructureError::InvalidOperation);
+        TRY(startIndex, findVertexIndex(start));
+        const size_t vertexCount = graph.vertices.size();
+        // Same indexed heap as Dijkstra, keyed by the lightest edge into the tree instead of a distance
+        auto& scratch = Matrix::threadScratch();
+        scratch.prepare(vertexCount);
+        const uint32_t generation = scratch.generation;
+        Frontier& frontier = scratch.forward;
+        std::vector<Edge> mstEdges;
+        mstEdges.reserve(vertexCount - 1);
+        frontier.reached[startIndex] = generation;
+        frontier.predecessor[startIndex] = vertexCount;
+        frontier.push(startIndex, 0, false);
+        while (!frontier.heap.empty()) {
+            size_t u = frontier.pop();
+            frontier.settled[u] = generation;
+            if (frontier.predecessor[u] != vertexCount) mstEdges.push_back({frontier.predecessor[u], u, frontier.key[u]});
+            for (size_t i = graph.offsets[u]; i < graph.offsets[u + 1]; i++) {
+                size_t v = graph.targets[i];
+                if (frontier.settled[v] == generation) continue;
+                bool queued = frontier.reached[v] == generation;
+                if (queued && !(graph.weights[i] < frontier.key[v])) continue;
+                frontier.reached[v] = generation;
+                frontier.predecessor[v] = u;
+                frontier.push(v, graph.weights[i], queued);
+            }
+        }
+        if (mstEdges.size() + 1 != vertexCount) return std::unexpected(DataStructureError::InvalidOperation);
+        return CSRGraph(graph.vertices, mstEdges, GraphType::Undirected);
+    }
+
+    std::expected<CSRGraph, DataStructureError> kruskalMST() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        if (graph.graphType != GraphType::Undirected) return std::unexpected(DataStructureError::InvalidOperation);
+        const size_t vertexCount = graph.vertices.size();
+        std::vector<Edge> allEdges;
+        for (size_t i = 0; i < vertexCount; i++) {
+            for (size_t k = graph.offsets[i]; k < graph.offsets[i + 1]; k++) {
+                if (graph.targets[k] > i) allEdges.push_back({i, graph.targets[k], graph.weights[k]});
+            }
+        }
+        std::sort(allEdges.begin(), allEdges.end(), [](const Edge& a, const Edge& b) { return a.weight < b.weight; });
+        DenseUnionFindSet components(vertexCount);
+        std::vector<Edge> mstEdges;
+        mstEdges.reserve(vertexCount - 1);
+        for (const auto& edge : allEdges) {
+            if (!components.unite(edge.start, edge.end)) continue;
+            mstEdges.push_back(edge);
+            if (mstEdges.size() + 1 == vertexCount) break;
+        }
+        if (mstEdges.size() + 1 != vertexCount) return std::unexpected(DataStructureError::InvalidOperation);
+        return CSRGraph(graph.vertices, mstEdges, GraphType::Undirected);
+    }
+
+    std::expected<void, DataStructureError> printCSRGraph() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        std::cout << "CSR Graph:" << std::endl;
+        std::cout << "Vertices: " << std::endl;
+        for (const auto& vertex : graph.vertices) std::cout << vertex << " ";
+        std::cout << std::endl;
+        std::cout << "Edges:" << std::endl;
+        for (size_t i = 0; i < graph.vertices.size(); i++) {
+            std::cout << graph.vertices[i] << ":";
+            for (size_t k = graph.offsets[i]; k < graph.offsets[i + 1]; k++) std::cout << " " << graph.vertices[graph.targets[k]] << "(" << graph.weights[k] << ")";
+            std::cout << std::endl;
+        }
+        return {};
+    }
+
+    void clear() {
+        graph.vertices.clear();
+        graph.offsets.assign(1, 0);
+        graph.targets.clear();
+        graph.weights.clear();
+        inDegrees.clear();
+        vertexIndex.clear();
+    }
+};
@@ -0,0 +1,156 @@
+#pragma once
+#include <span>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include "adjacency_matrix_graph.hpp"
+#include "../error/error.hpp"
+
+// Read-only CSR arrays and the queries that need nothing else. CSRGraph views its vectors and MappedGraph a mapped
+// snapshot, so both share one implementation; callers resolve and check vertex indices before calling in
+template<typename V, typename E>
+struct CSRView {
+    using ShortestPath = typename AdjacencyMatrixGraph<V, E>::ShortestPath;
+    using Matrix = AdjacencyMatrixGraph<V, E>;
+    using Scratch = typename Matrix::ShortestPathScratch;
+
+    std::span<const V> vertices;
+    std::span<const size_t> offsets;
+    std::span<const size_t> targets;
+    std::span<const E> weights;
+
+    // Dijkstra from source on the indexed decrease-key heap of AdjacencyMatrixGraph; stops once target is settled
+    Scratch& search(size_t source, size_t target) const {
+        const size_t vertexCount = vertices.size();
+        Scratch& scratch = Matrix::threadScratch();
+        scratch.prepare(vertexCount);
+        const uint32_t generation = scratch.generation;
+        auto& frontier = scratch.forward;
+        frontier.reached[source] = generation;
+        frontier.distance[source] = 0;
+        frontier.predecessor[source] = vertexCount;
+        frontier.push(source, 0, false);
+        while (!frontier.heap.empty()) {
+            size_t current = frontier.pop();
+            frontier.settled[current] = generation;
+            if (current == target) break;
+            for (size_t i = offsets[current]; i < offsets[current + 1]; i++) {
+                Matrix::relaxTowards(frontier, generation, current, targets[i], weights[i], 0);
+            }
+        }
+        return scratch;
+    }
+
+    std::expected<size_t, DataStructureError> findEdgePosition(size_t startIndex, size_t endIndex) const {
+        auto first = targets.begin() + offsets[startIndex];
+        auto last = targets.begin() + offsets[startIndex + 1];
+        auto it = std::lower_bound(first, last, endIndex);
+        if (it == last || *it != endIndex) return std::unexpected(DataStructureError::ElementNotFound);
+        return static_cast<size_t>(it - targets.begin());
+    }
+
+    std::vector<V> neighbours(size_t index, const std::function<void(V)>& visitor) const {
+        std::vector<V> result;
+        result.reserve(offsets[index + 1] - offsets[index]);
+        for (size_t i = offsets[index]; i < offsets[index + 1]; i++) result.push_back(vertices[targets[i]]);
+        for (const auto& neighbour : result) visitor(neighbour);
+        return result;
+    }
+
+    // Same visiting order as the recursive formulation, but the call stack lives in frames of (vertex, next arc)
+    std::vector<V> DFSRecursive(size_t startIndex, const std::function<void(V)>& visitor) const {
+        std::vector<V> visited;
+        std::vector<bool> isVisited(vertices.size(), false);
+        std::vector<std::pair<size_t, size_t>> frames;
+        auto enter = [&](size_t index) {
+            isVisited[index] = true;
+            visited.push_back(vertices[index]);
+            visitor(vertices[index]);
+            frames.push_back({index, offsets[index]});
+        };
+        enter(startIndex);
+        while (!frames.empty()) {
+            auto& [index, cursor] = frames.back();
+            if (cursor == offsets[index + 1]) {
+                frames.pop_back();
+                continue;
+            }
+            size_t next = targets[cursor++];
+            if (!isVisited[next]) enter(next);
+        }
+        return visited;
+    }
+
+    std::vector<V> DFSIterative(size_t startIndex, const std::function<void(V)>& visitor) const {
+        std::vector<V> visited;
+        std::vector<bool> isVisited(vertices.size(), false);
+        std::vector<size_t> unvisited{startIndex};
+        while (!unvisited.empty()) {
+            size_t currentIndex = unvisited.back();
+            unvisited.pop_back();
+            if (isVisited[currentIndex]) continue;
+            isVisited[currentIndex] = true;
+            visited.push_back(vertices[currentIndex]);
+            visitor(vertices[currentIndex]);
+            for (size_t i = offsets[currentIndex]; i < offsets[currentIndex + 1]; i++) {
+                if (!isVisited[targets[i]]) unvisited.push_back(targets[i]);
+            }
+        }
+        return visited;
+    }
+
+    std::vector<V> BFS(size_t startIndex, const std::function<void(V)>& visitor) const {
+        std::vector<V> visited;
+        std::vector<bool> isVisited(vertices.size(), false);
+        std::vector<size_t> unvisited{startIndex};
+        isVisited[startIndex] = true;
+        for (size_t head = 0; head < unvisited.size(); head++) {
+            size_t currentIndex = unvisited[head];
+            visited.push_back(vertices[currentIndex]);
+            visitor(vertices[currentIndex]);
+            for (size_t i = offsets[currentIndex]; i < offsets[currentIndex + 1]; i++) {
+                if (isVisited[targets[i]]) continue;
+                isVisited[targets[i]] = true;
+                unvisited.push_back(targets[i]);
+            }
+        }
+        return visited;
+    }
+
+    bool hasPath(size_t startIndex, size_t endIndex) const {
+        if (startIndex == endIndex) return true;
+        std::vector<bool> isVisited(vertices.size(), false);
+        std::vector<size_t> unvisited{startIndex};
+        isVisited[startIndex] = true;
+        for (size_t head = 0; head < unvisited.size(); head++) {
+            size_t currentIndex = unvisited[head];
+            for (size_t i = offsets[currentIndex]; i < offsets[currentIndex + 1]; i++) {
+                size_t neighbour = targets[i];
+                if (neighbour == endIndex) return true;
+                if (isVisited[neighbour]) continue;
+                isVisited[neighbour] = true;
+                unvisited.push_back(neighbour);
+            }
+        }
+        return false;
+    }
+
+    std::vector<E> Dijkstra(size_t startIndex) const {
+        const size_t vertexCount = vertices.size();
+        const Scratch& scratch = search(startIndex, vertexCount);
+        std::vector<E> distances(vertexCount, std::numeric_limits<E>::max());
+        for (size_t i = 0; i < vertexCount; i++) if (scratch.forward.settled[i] == scratch.generation) distances[i] = scratch.forward.distance[i];
+        return distances;
+    }
+
+    std::expected<ShortestPath, DataStructureError> shortestPath(size_t sourceIndex, size_t targetIndex) const {
+        const size_t vertexCount = vertices.size();
+        const Scratch& scratch = search(sourceIndex, targetIndex);
+        if (scratch.forward.settled[targetIndex] != scratch.generation) return std::unexpected(DataStructureError::ElementNotFound);
+        ShortestPath result{scratch.forward.distance[targetIndex], {}};
+        for (size_t index = targetIndex; index != vertexCount; index = scratch.forward.predecessor[index]) result.path.push_back(vertices[index]);
+        std::reverse(result.path.begin(), result.path.end());
+        return result;
+    }
+};
@@ -0,0 +1,118 @@
+#pragma once
+#include <vector>
+#include <span>
+#include <map>
+#include <utility>
+#include <algorithm>
+#include "adjacency_matrix_graph.hpp"
+#include "../set/union_find_set.hpp"
+#include "../error/error.hpp"
+
+enum class ConnectivityEventType {
+    AddEdge,
+    RemoveEdge,
+    Query
+};
+
+// One step of a timeline over undirected edges: insert or delete {first, second}, or ask whether the two are connected
+template<typename V>
+struct ConnectivityEvent {
+    ConnectivityEventType type;
+    V first;
+    V second;
+};
+
+// Offline dynamic connectivity, divide and conquer over time: every edge is alive for an interval of queries, which a
+// segment tree over the queries splits into O(log Q) nodes. A depth-first walk unites the edges of a node on entry and
+// rolls them back on exit, so each leaf sees exactly the edges alive at its query: O((E log Q + Q) log V) for E insertions
+// and Q queries. Edges may repeat and RemoveEdge drops one copy. Returns one answer per Query, in timeline order
+inline std::expected<std::vector<bool>, DataStructureError> offlineConnectivityByIndex(size_t vertexCount, std::span<const ConnectivityEvent<size_t>> events) {
+    struct Lifetime {
+        size_t first;   // alive for queries [first, last)
+        size_t last;
+        std::pair<size_t, size_t> edge;
+    };
+    std::vector<std::pair<size_t, size_t>> queries;
+    std::vector<Lifetime> lifetimes;
+    std::map<std::pair<size_t, size_t>, std::vector<size_t>> open;
+    for (const auto& event : events) {
+        if (event.first >= vertexCount || event.second >= vertexCount) return std::unexpected(DataStructureError::IndexOutOfRange);
+        const auto edge = std::minmax(event.first, event.second);
+        if (event.type == ConnectivityEventType::Query) queries.push_back(edge);
+        else if (event.type == ConnectivityEventType::AddEdge) open[edge].push_back(queries.size());
+        else {
+            auto it = open.find(edge);
+            if (it == open.end()) return std::unexpected(DataStructureError::ElementNotFound);
+            const size_t first = it->second.back();
+            it->second.pop_back();
+            if (it->second.empty()) open.erase(it);
+            if (first < queries.size()) lifetimes.push_back({first, queries.size(), edge});
+        }
+    }
+    const size_t queryCount = queries.size();
+    for (const auto& [edge, starts] : open) {
+        for (size_t first : starts) if (first < queryCount) lifetimes.push_back({first, queryCount, edge});
+    }
+    std::vector<bool> answers(queryCount);
+    if (queryCount == 0) return answers;
+    size_t leafCount = 1;
+    while (leafCount < queryCount) leafCount *= 2;
+    std::vector<std::vector<std::pair<size_t, size_t>>> nodeEdges(2 * leafCount);
+    for (const auto& lifetime : lifetimes) {
+        for (size_t l = lifetime.first + leafCount, r = lifetime.last + leafCount; l < r; l /= 2, r /= 2) {
+            if (l & 1) nodeEdges[l++].push_back(lifetime.edge);
+            if (r & 1) nodeEdges[--r].push_back(lifetime.edge);
+        }
+    }
+    RollbackUnionFindSet components(vertexCount);
+    struct Frame {
+        size_t node;
+        size_t checkpoint;
+        bool entered;
+    };
+    std::vector<Frame> stack{{1, 0, false}};
+    auto hasQueries = [&](size_t node) {
+        while (node < leafCount) node *= 2;
+        return node - leafCount < queryCount;
+    };
+    while (!stack.empty()) {
+        Frame& frame = stack.back();
+        if (frame.entered) {
+            components.rollback(frame.checkpoint);
+            stack.pop_back();
+            continue;
+        }
+        frame.entered = true;
+        frame.checkpoint = components.checkpoint();
+        const size_t node = frame.node;
+        for (const auto& [u, v] : nodeEdges[node]) components.unite(u, v);
+        if (node >= leafCount) {
+            answers[node - leafCount] = components.isConnected(queries[node - leafCount].first, queries[node - leafCount].second);
+            continue;
+        }
+        if (hasQueries(2 * node + 1)) stack.push_back({2 * node + 1, 0, false});
+        stack.push_back({2 * node, 0, false});
+    }
+    return answers;
+}
+
+// Same over the vertices of an undirected graph, whose current edges are alive from the start of the timeline
+template<typename V, typename E>
+std::expected<std::vector<bool>, DataStructureError> offlineConnectivity(const AdjacencyMatrixGraph<V, E>& graph, const std::vector<ConnectivityEvent<V>>& events) {
+    using Graph = AdjacencyMatrixGraph<V, E>;
+    if (graph.getGraph().graphType != Graph::GraphType::Undirected) return std::unexpected(DataStructureError::InvalidOperation);
+    const auto& matrix = graph.getGraph().edges;
+    std::vector<ConnectivityEvent<size_t>> indexed;
+    for (size_t i = 0; i < matrix.size(); i++) {
+        matrix.forEachNeighbour(i, [&](size_t j) {
+            if (i <= j) indexed.push_back({ConnectivityEventType::AddEdge, i, j});
+        });
+    }
+    indexed.reserve(indexed.size() + events.size());
+    for (const auto& event : events) {
+        TRY(first, graph.getVertexIndex(event.first));
+        TRY(second, graph.getVertexIndex(event.second));
+        indexed.push_back({event.type, first, second});
+    }
+    return offlineConnectivityByIndex(matrix.size(), indexed);
+}
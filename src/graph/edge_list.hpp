@@ -0,0 +1,190 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <charconv>
+#include <limits>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include "adjacency_matrix_graph.hpp"
+#include "../thread/thread_pool.hpp"
+#include "../error/error.hpp"
+
+// Vertex table plus index-based edges, ready for the bulk constructors of AdjacencyMatrixGraph and CSRGraph
+template<typename V, typename E>
+struct EdgeList {
+    using Edge = typename AdjacencyMatrixGraph<V, E>::Edge;
+    std::vector<V> vertices;
+    std::vector<Edge> edges;
+};
+
+template<typename T>
+bool parseEdgeListToken(std::string_view token, T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        if (token == "true" || token == "1") value = true;
+        else if (token == "false" || token == "0") value = false;
+        else return false;
+        return true;
+    }
+    else if constexpr (std::is_arithmetic_v<T>) {
+        auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+        return error == std::errc{} && end == token.data() + token.size();
+    }
+    else {
+        value = T(token);
+        return true;
+    }
+}
+
+// Open-addressing vertex -> index table with Fibonacci hashing; the ingestion hot path does one probe per endpoint
+// instead of a node allocation and pointer chase per unordered_map insert
+template<typename V>
+class VertexIndexTable {
+protected:
+    static constexpr size_t Empty = std::numeric_limits<size_t>::max();
+
+    // Key and index share a slot so a probe touches one cache line
+    struct Slot {
+        V vertex{};
+        size_t index = Empty;
+    };
+
+    std::vector<Slot> slots;
+    size_t count = 0;
+    int shift = 64;
+
+    size_t slotFor(const V& vertex) const { return static_cast<size_t>((static_cast<uint64_t>(std::hash<V>{}(vertex)) * 0x9E3779B97F4A7C15ull) >> shift); }
+
+    void rehash(size_t capacity) {
+        std::vector<Slot> oldSlots = std::exchange(slots, std::vector<Slot>(capacity));
+        shift = 64 - std::countr_zero(capacity);
+        for (auto& slot : oldSlots) {
+            if (slot.index == Empty) continue;
+            size_t position = slotFor(slot.vertex);
+            while (slots[position].index != Empty) position = (position + 1) & (capacity - 1);
+            slots[position] = std::move(slot);
+        }
+    }
+
+public:
+    explicit VertexIndexTable(size_t expected = 0) { rehash(std::bit_ceil(std::max<size_t>(16, expected * 2))); }
+
+    size_t size() const { return count; }
+
+    // Index already stored for vertex, or index itself after inserting it
+    size_t insert(const V& vertex, size_t index) {
+        if ((count + 1) * 2 > slots.size()) rehash(slots.size() * 2);
+        size_t position = slotFor(vertex);
+        while (slots[position].index != Empty) {
+            if (slots[position].vertex == vertex) return slots[position].index;
+            position = (position + 1) & (slots.size() - 1);
+        }
+        slots[position] = {vertex, index};
+        count++;
+        return index;
+    }
+};
+
+// Parses "u v [w]" lines (missing weights read as 1; blank lines and lines starting with # or % are skipped). The text is
+// split at line boundaries into chunks that parse and number their own vertices in parallel; the chunk vertex lists are
+// then merged in order, so vertex indices follow first appearance in the text, and edges are renumbered in parallel
+template<typename V, typename E>
+std::expected<EdgeList<V, E>, DataStructureError> parseEdgeList(std::string_view text, ThreadPool& pool) {
+    struct Chunk {
+        std::string_view text;
+        std::vector<V> vertices;
+        std::vector<size_t> endpoints;
+        std::vector<E> weights;
+        std::vector<size_t> globalIndex;
+        bool malformed = false;
+    };
+    const size_t chunkCount = std::max<size_t>(1, std::min(text.size() / 4096, pool.getThreadCount()));
+    std::vector<Chunk> chunks(chunkCount);
+    size_t chunkBegin = 0;
+    for (size_t c = 0; c < chunkCount; c++) {
+        size_t chunkEnd = c + 1 == chunkCount ? text.size() : std::max(chunkBegin, text.size() * (c + 1) / chunkCount);
+        while (chunkEnd < text.size() && text[chunkEnd - 1] != '\n') chunkEnd++;
+        chunks[c].text = text.substr(chunkBegin, chunkEnd - chunkBegin);
+        chunkBegin = chunkEnd;
+    }
+    pool.parallelFor(0, chunkCount, [&](size_t begin, size_t end, size_t) {
+        for (size_t c = begin; c < end; c++) {
+            Chunk& chunk = chunks[c];
+            const size_t lineCount = std::count(chunk.text.begin(), chunk.text.end(), '\n') + 1;
+            std::vector<V> labels;
+            labels.reserve(lineCount * 2);
+            chunk.weights.reserve(lineCount);
+            std::string_view rest = chunk.text;
+            while (!rest.empty()) {
+                size_t lineEnd = rest.find('\n');
+                std::string_view line = rest.substr(0, lineEnd);
+                rest = lineEnd == std::string_view::npos ? std::string_view{} : rest.substr(lineEnd + 1);
+                std::string_view tokens[4];
+                size_t tokenCount = 0;
+                for (size_t position = 0; position < line.size() && tokenCount < 4;) {
+                    while (position < line.size() && (line[position] == ' ' || line[position] == '\t' || line[position] == '\r')) position++;
+                    size_t tokenBegin = position;
+                    while (position < line.size() && line[position] != ' ' && line[position] != '\t' && line[position] != '\r') position++;
+                    if (position > tokenBegin) tokens[tokenCount++] = line.substr(tokenBegin, position - tokenBegin);
+                }
+                if (tokenCount == 0 || tokens[0][0] == '#' || tokens[0][0] == '%') continue;
+                V start{};
+                V end{};
+                E weight(1);
+                if (tokenCount < 2 || tokenCount > 3 || !parseEdgeListToken(tokens[0], start) || !parseEdgeListToken(tokens[1], end) ||
+                    (tokenCount == 3 && !parseEdgeListToken(tokens[2], weight))) {
+                    chunk.malformed = true;
+                    break;
+                }
+                labels.push_back(std::move(start));
+                labels.push_back(std::move(end));
+                chunk.weights.push_back(weight);
+            }
+            // Numbering runs as its own tight loop after parsing so independent table misses can overlap
+            VertexIndexTable<V> seen;
+            chunk.endpoints.resize(labels.size());
+            for (size_t k = 0; k < labels.size(); k++) {
+                chunk.endpoints[k] = seen.insert(labels[k], chunk.vertices.size());
+                if (chunk.endpoints[k] == chunk.vertices.size()) chunk.vertices.push_back(std::move(labels[k]));
+            }
+        }
+    }, 1);
+    EdgeList<V, E> list;
+    VertexIndexTable<V> vertexIndex;
+    std::vector<size_t> edgeOffsets(chunkCount + 1, 0);
+    for (size_t c = 0; c < chunkCount; c++) {
+        if (chunks[c].malformed) return std::unexpected(DataStructureError::InvalidFileFormat);
+        chunks[c].globalIndex.resize(chunks[c].vertices.size());
+        for (size_t i = 0; i < chunks[c].vertices.size(); i++) {
+            size_t index = vertexIndex.insert(chunks[c].vertices[i], list.vertices.size());
+            if (index == list.vertices.size()) list.vertices.push_back(std::move(chunks[c].vertices[i]));
+            chunks[c].globalIndex[i] = index;
+        }
+        edgeOffsets[c + 1] = edgeOffsets[c] + chunks[c].weights.size();
+    }
+    list.edges.resize(edgeOffsets[chunkCount]);
+    pool.parallelFor(0, chunkCount, [&](size_t begin, size_t end, size_t) {
+        for (size_t c = begin; c < end; c++) {
+            const Chunk& chunk = chunks[c];
+            for (size_t k = 0; k < chunk.weights.size(); k++) {
+                list.edges[edgeOffsets[c] + k] = {chunk.globalIndex[chunk.endpoints[2 * k]], chunk.globalIndex[chunk.endpoints[2 * k + 1]], chunk.weights[k]};
+            }
+        }
+    }, 1);
+    return list;
+}
+
+template<typename V, typename E>
+std::expected<EdgeList<V, E>, DataStructureError> readEdgeList(const std::string& path, ThreadPool& pool) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) return std::unexpected(DataStructureError::FileOperationFailed);
+    std::string text(static_cast<size_t>(in.tellg()), '\0');
+    in.seekg(0);
+    if (!in.read(text.data(), static_cast<std::streamsize>(text.size()))) return std::unexpected(DataStructureError::FileOperationFailed);
+    return parseEdgeList<V, E>(text, pool);
+}
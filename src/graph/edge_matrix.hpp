@@ -0,0 +1,282 @@
+#pragma once
+#include <vector>
+#include <span>
+#include <new>
+#include <bit>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+template<typename T, size_t Alignment = 64>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template<typename U>
+    struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+    AlignedAllocator() = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+    T* allocate(size_t count) { return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{Alignment})); }
+
+    void deallocate(T* pointer, size_t) { ::operator delete(pointer, std::align_val_t{Alignment}); }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+};
+
+// One presence bit per cell, row-major, rows padded to whole cache lines. Neighbour scans walk
+// 64 columns per word with countr_zero instead of comparing edge values cell by cell.
+class EdgePresenceMatrix {
+public:
+    static constexpr size_t CacheLineSize = 64;
+    static constexpr size_t WordBits = 64;
+
+protected:
+    std::vector<uint64_t, AlignedAllocator<uint64_t, CacheLineSize>> bits;
+    size_t vertexCount = 0;
+    size_t capacity = 0;
+    size_t rowWords = 0;
+
+    static size_t wordsFor(size_t columns) {
+        const size_t perLine = CacheLineSize / sizeof(uint64_t);
+        return ((columns + WordBits - 1) / WordBits + perLine - 1) / perLine * perLine;
+    }
+
+    static size_t grownCapacity(size_t size, size_t capacity) { return std::max(size, capacity + capacity / 2); }
+
+    size_t usedWords() const { return (vertexCount + WordBits - 1) / WordBits; }
+
+    void reallocateBits(size_t newCapacity) {
+        const size_t newRowWords = wordsFor(newCapacity);
+        std::vector<uint64_t, AlignedAllocator<uint64_t, CacheLineSize>> newBits(newRowWords * newCapacity, 0);
+        for (size_t i = 0; i < vertexCount; i++) std::copy_n(bits.begin() + i * rowWords, usedWords(), newBits.begin() + i * newRowWords);
+        bits.swap(newBits);
+        capacity = newCapacity;
+        rowWords = newRowWords;
+    }
+
+    static std::vector<size_t> inversePermutation(const std::vector<size_t>& order) {
+        std::vector<size_t> inverse(order.size());
+        for (size_t i = 0; i < order.size(); i++) inverse[order[i]] = i;
+        return inverse;
+    }
+
+    void setBit(size_t row, size_t column) { bits[row * rowWords + column / WordBits] |= uint64_t{1} << (column % WordBits); }
+
+    void clearBit(size_t row, size_t column) { bits[row * rowWords + column / WordBits] &= ~(uint64_t{1} << (column % WordBits)); }
+
+    void assignBit(size_t row, size_t column, bool value) {
+        if (value) setBit(row, column);
+        else clearBit(row, column);
+    }
+
+public:
+    EdgePresenceMatrix() = default;
+
+    explicit EdgePresenceMatrix(size_t size) { resize(size); }
+
+    size_t size() const { return vertexCount; }
+
+    size_t wordsPerRow() const { return rowWords; }
+
+    const uint64_t* presenceRow(size_t row) const { return bits.data() + row * rowWords; }
+
+    bool hasEdge(size_t start, size_t end) const { return (bits[start * rowWords + end / WordBits] >> (end % WordBits)) & 1; }
+
+    size_t rowDegree(size_t row) const {
+        const uint64_t* words = presenceRow(row);
+        size_t degree = 0;
+        for (size_t w = 0; w < usedWords(); w++) degree += std::popcount(words[w]);
+        return degree;
+    }
+
+    // First neighbour at or after from, or size() if there is none
+    size_t nextNeighbour(size_t row, size_t from) const {
+        if (from >= vertexCount) return vertexCount;
+        const uint64_t* words = presenceRow(row);
+        size_t w = from / WordBits;
+        uint64_t word = words[w] & (~uint64_t{0} << (from % WordBits));
+        while (word == 0) {
+            if (++w == usedWords()) return vertexCount;
+            word = words[w];
+        }
+        return w * WordBits + std::countr_zero(word);
+    }
+
+    // Last neighbour strictly before before, or size() if there is none
+    size_t previousNeighbour(size_t row, size_t before) const {
+        if (before == 0) return vertexCount;
+        const uint64_t* words = presenceRow(row);
+        size_t last = std::min(before, vertexCount) - 1;
+        size_t w = last / WordBits;
+        uint64_t word = words[w] & (~uint64_t{0} >> (WordBits - 1 - last % WordBits));
+        while (word == 0) {
+            if (w-- == 0) return vertexCount;
+            word = words[w];
+        }
+        return w * WordBits + WordBits - 1 - std::countl_zero(word);
+    }
+
+    template<typename F>
+    void forEachNeighbour(size_t row, F&& visit) const {
+        const uint64_t* words = presenceRow(row);
+        for (size_t w = 0; w < usedWords(); w++) {
+            for (uint64_t word = words[w]; word != 0; word &= word - 1) visit(w * WordBits + std::countr_zero(word));
+        }
+    }
+
+    void resize(size_t size) {
+        if (size > capacity) reallocateBits(grownCapacity(size, capacity));
+        for (size_t i = size; i < vertexCount; i++) {
+            std::fill_n(bits.begin() + i * rowWords, rowWords, 0);
+            for (size_t j = 0; j < size; j++) clearBit(j, i);
+        }
+        vertexCount = size;
+    }
+
+    void addVertex() { resize(vertexCount + 1); }
+
+    // Moves the last vertex into index and drops the last row and column
+    void swapRemove(size_t index) {
+        const size_t last = vertexCount - 1;
+        if (index != last) {
+            std::copy_n(bits.begin() + last * rowWords, rowWords, bits.begin() + index * rowWords);
+            for (size_t i = 0; i < vertexCount; i++) assignBit(i, index, hasEdge(i, last));
+            assignBit(index, index, hasEdge(last, last));
+        }
+        resize(last);
+    }
+
+    // Relabels rows and columns together: new index i takes over old index order[i] (order must be a permutation)
+    void permute(const std::vector<size_t>& order) {
+        const std::vector<size_t> newIndex = inversePermutation(order);
+        std::vector<uint64_t, AlignedAllocator<uint64_t, CacheLineSize>> newBits(bits.size(), 0);
+        for (size_t i = 0; i < vertexCount; i++) {
+            uint64_t* row = newBits.data() + i * rowWords;
+            forEachNeighbour(order[i], [&](size_t j) { row[newIndex[j] / WordBits] |= uint64_t{1} << (newIndex[j] % WordBits); });
+        }
+        bits.swap(newBits);
+    }
+
+    void shrinkToFit() { reallocateBits(vertexCount); }
+
+    void clear() {
+        bits.clear();
+        vertexCount = 0;
+        capacity = 0;
+        rowWords = 0;
+    }
+};
+
+// Weighted square matrix: presence bits plus one row-major weight buffer with the same growth and
+// cache-line padded rows. Absent cells always hold E{}, so zero weights are real edges.
+template<typename E>
+class EdgeMatrix : public EdgePresenceMatrix {
+protected:
+    std::vector<E, AlignedAllocator<E, CacheLineSize>> cells;
+    size_t weightCapacity = 0;
+    size_t rowStride = 0;
+
+    static size_t strideFor(size_t columns) {
+        if (CacheLineSize % sizeof(E) != 0) return columns;
+        const size_t perLine = CacheLineSize / sizeof(E);
+        return (columns + perLine - 1) / perLine * perLine;
+    }
+
+    void reallocateWeights(size_t newCapacity) {
+        const size_t newStride = strideFor(newCapacity);
+        std::vector<E, AlignedAllocator<E, CacheLineSize>> newCells(newStride * newCapacity, E{});
+        for (size_t i = 0; i < vertexCount; i++) std::copy_n(cells.begin() + i * rowStride, vertexCount, newCells.begin() + i * newStride);
+        cells.swap(newCells);
+        weightCapacity = newCapacity;
+        rowStride = newStride;
+    }
+
+public:
+    EdgeMatrix() = default;
+
+    explicit EdgeMatrix(size_t size) { resize(size); }
+
+    size_t stride() const { return rowStride; }
+
+    const E* data() const { return cells.data(); }
+
+    std::span<const E> operator[](size_t row) const { return std::span<const E>(cells.data() + row * rowStride, vertexCount); }
+
+    E weight(size_t start, size_t end) const { return cells[start * rowStride + end]; }
+
+    void setEdge(size_t start, size_t end, E weight) {
+        cells[start * rowStride + end] = weight;
+        setBit(start, end);
+    }
+
+    void removeEdge(size_t start, size_t end) {
+        cells[start * rowStride + end] = E{};
+        clearBit(start, end);
+    }
+
+    void resize(size_t size) {
+        if (size > weightCapacity) reallocateWeights(grownCapacity(size, weightCapacity));
+        for (size_t i = size; i < vertexCount; i++) {
+            std::fill_n(cells.begin() + i * rowStride, vertexCount, E{});
+            for (size_t j = 0; j < size; j++) cells[j * rowStride + i] = E{};
+        }
+        EdgePresenceMatrix::resize(size);
+    }
+
+    void addVertex() { resize(vertexCount + 1); }
+
+    void swapRemove(size_t index) {
+        const size_t last = vertexCount - 1;
+        if (index != last) {
+            std::copy_n(cells.begin() + last * rowStride, vertexCount, cells.begin() + index * rowStride);
+            for (size_t i = 0; i < vertexCount; i++) cells[i * rowStride + index] = cells[i * rowStride + last];
+            cells[index * rowStride + index] = cells[last * rowStride + last];
+        }
+        std::fill_n(cells.begin() + last * rowStride, vertexCount, E{});
+        for (size_t i = 0; i < vertexCount; i++) cells[i * rowStride + last] = E{};
+        EdgePresenceMatrix::swapRemove(index);
+    }
+
+    void permute(const std::vector<size_t>& order) {
+        const std::vector<size_t> newIndex = inversePermutation(order);
+        std::vector<E, AlignedAllocator<E, CacheLineSize>> newCells(cells.size(), E{});
+        for (size_t i = 0; i < vertexCount; i++) {
+            const E* oldRow = cells.data() + order[i] * rowStride;
+            E* row = newCells.data() + i * rowStride;
+            forEachNeighbour(order[i], [&](size_t j) { row[newIndex[j]] = oldRow[j]; });
+        }
+        cells.swap(newCells);
+        EdgePresenceMatrix::permute(order);
+    }
+
+    void shrinkToFit() {
+        reallocateWeights(vertexCount);
+        EdgePresenceMatrix::shrinkToFit();
+    }
+
+    void clear() {
+        cells.clear();
+        weightCapacity = 0;
+        rowStride = 0;
+        EdgePresenceMatrix::clear();
+    }
+};
+
+// Unweighted graphs keep only the presence bits: one bit per cell instead of sizeof(E) bytes
+template<>
+class EdgeMatrix<bool> : public EdgePresenceMatrix {
+public:
+    EdgeMatrix() = default;
+
+    explicit EdgeMatrix(size_t size) : EdgePresenceMatrix(size) {}
+
+    bool weight(size_t start, size_t end) const { return hasEdge(start, end); }
+
+    void setEdge(size_t start, size_t end, bool) { setBit(start, end); }
+
+    void removeEdge(size_t start, size_t end) { clearBit(start, end); }
+};
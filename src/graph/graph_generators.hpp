@@ -0,0 +1,126 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <random>
+#include <numeric>
+#include <cstdint>
+#include <type_traits>
+#include "edge_list.hpp"
+#include "../random/random.hpp"
+#include "../error/error.hpp"
+
+// Seeded synthetic workloads. Every generator returns an EdgeList over vertices 0 .. n-1 for the bulk constructors of
+// AdjacencyMatrixGraph / CSRGraph, and the same seed always yields the same list
+
+template<typename E>
+E randomWeight(RandomEngine& gen, E minWeight, E maxWeight) {
+    if constexpr (std::is_same_v<E, bool>) return true;
+    else if constexpr (std::is_integral_v<E>) return std::uniform_int_distribution<E>(minWeight, maxWeight)(gen);
+    else return std::uniform_real_distribution<E>(minWeight, maxWeight)(gen);
+}
+
+template<typename E>
+EdgeList<size_t, E> emptyEdgeList(size_t vertexCount) {
+    EdgeList<size_t, E> list;
+    list.vertices.resize(vertexCount);
+    std::iota(list.vertices.begin(), list.vertices.end(), 0);
+    return list;
+}
+
+// G(n, p) with geometric skips between chosen pairs (Batagelj and Brandes), O(V + E) instead of one coin per pair.
+// Directed lists every ordered pair i != j at most once, undirected every pair i < j
+template<typename E>
+std::expected<EdgeList<size_t, E>, DataStructureError> erdosRenyiGraph(size_t vertexCount, double edgeProbability, bool directed, uint64_t seed, E minWeight = E(1), E maxWeight = E(1)) {
+    if (edgeProbability < 0 || edgeProbability > 1 || maxWeight < minWeight) return std::unexpected(DataStructureError::InvalidArgument);
+    auto list = emptyEdgeList<E>(vertexCount);
+    if (vertexCount < 2 || edgeProbability == 0) return list;
+    RandomEngine gen(seed);
+    const uint64_t rowLength = directed ? vertexCount - 1 : 0;
+    const uint64_t pairCount = directed ? vertexCount * rowLength : vertexCount * (vertexCount - 1) / 2;
+    list.edges.reserve(static_cast<size_t>(pairCount * edgeProbability * 1.05) + 16);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    const double logMiss = std::log1p(-edgeProbability);
+    size_t row = 0;
+    uint64_t rowStart = 0;
+    for (uint64_t pair = 0;; pair++) {
+        if (edgeProbability < 1) {
+            double skip = std::floor(std::log1p(-unit(gen)) / logMiss);
+            if (skip >= static_cast<double>(pairCount - pair)) break;
+            pair += static_cast<uint64_t>(skip);
+        }
+        if (pair >= pairCount) break;
+        size_t start, end;
+        if (directed) {
+            start = static_cast<size_t>(pair / rowLength);
+            end = static_cast<size_t>(pair % rowLength);
+            if (end >= start) end++;
+        }
+        else {
+            // Row r of the upper triangle holds pairs (r, r + 1 .. n - 1); rows only ever advance
+            while (pair >= rowStart + (vertexCount - 1 - row)) rowStart += vertexCount - 1 - row++;
+            start = row;
+            end = row + 1 + static_cast<size_t>(pair - rowStart);
+        }
+        list.edges.push_back({start, end, randomWeight(gen, minWeight, maxWeight)});
+    }
+    return list;
+}
+
+// R-MAT (Chakrabarti et al.): 2^scale vertices and edgeFactor * 2^scale directed edges, each dropped into quadrant a, b, c
+// or d = 1 - a - b - c at every level of the adjacency matrix, giving skewed Kronecker-like degrees. Self loops are discarded
+template<typename E>
+std::expected<EdgeList<size_t, E>, DataStructureError> rmatGraph(size_t scale, size_t edgeFactor, uint64_t seed, double a = 0.57, double b = 0.19, double c = 0.19, E minWeight = E(1), E maxWeight = E(1)) {
+    if (scale >= 8 * sizeof(size_t) || a < 0 || b < 0 || c < 0 || a + b + c > 1 || maxWeight < minWeight) return std::unexpected(DataStructureError::InvalidArgument);
+    const size_t vertexCount = size_t{1} << scale;
+    auto list = emptyEdgeList<E>(vertexCount);
+    RandomEngine gen(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    list.edges.reserve(vertexCount * edgeFactor);
+    for (size_t k = 0; k < vertexCount * edgeFactor; k++) {
+        size_t start = 0, end = 0;
+        for (size_t bit = size_t{1} << scale >> 1; bit != 0; bit >>= 1) {
+            double r = unit(gen);
+            if (r >= a + b + c) start |= bit, end |= bit;
+            else if (r >= a + b) start |= bit;
+            else if (r >= a) end |= bit;
+        }
+        if (start != end) list.edges.push_back({start, end, randomWeight(gen, minWeight, maxWeight)});
+    }
+    return list;
+}
+
+// Road-like rows x columns lattice: vertex r * columns + c links to its right and lower neighbours (listed once, meant
+// for undirected graphs); each link survives with keepProbability so the grid gets irregular holes
+template<typename E>
+std::expected<EdgeList<size_t, E>, DataStructureError> gridGraph(size_t rows, size_t columns, uint64_t seed, double keepProbability = 1.0, E minWeight = E(1), E maxWeight = E(1)) {
+    if (keepProbability < 0 || keepProbability > 1 || maxWeight < minWeight) return std::unexpected(DataStructureError::InvalidArgument);
+    auto list = emptyEdgeList<E>(rows * columns);
+    RandomEngine gen(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    list.edges.reserve(rows * columns * 2);
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t c = 0; c < columns; c++) {
+            const size_t vertex = r * columns + c;
+            if (c + 1 < columns && unit(gen) < keepProbability) list.edges.push_back({vertex, vertex + 1, randomWeight(gen, minWeight, maxWeight)});
+            if (r + 1 < rows && unit(gen) < keepProbability) list.edges.push_back({vertex, vertex + columns, randomWeight(gen, minWeight, maxWeight)});
+        }
+    }
+    return list;
+}
+
+// Layered DAG: vertices fill consecutive layers of width vertices and every vertex sends outDegree edges to random
+// vertices of the next layer, so the longest path is about V / width and any antichain within a layer is at most width
+template<typename E>
+std::expected<EdgeList<size_t, E>, DataStructureError> layeredDAG(size_t vertexCount, size_t width, size_t outDegree, uint64_t seed, E minWeight = E(1), E maxWeight = E(1)) {
+    if (width == 0 || maxWeight < minWeight) return std::unexpected(DataStructureError::InvalidArgument);
+    auto list = emptyEdgeList<E>(vertexCount);
+    RandomEngine gen(seed);
+    list.edges.reserve(vertexCount * outDegree);
+    for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+        const size_t nextLayer = (vertex / width + 1) * width;
+        if (nextLayer >= vertexCount) break;
+        std::uniform_int_distribution<size_t> target(nextLayer, std::min(nextLayer + width, vertexCount) - 1);
+        for (size_t k = 0; k < outDegree; k++) list.edges.push_back({vertex, target(gen), randomWeight(gen, minWeight, maxWeight)});
+    }
+    return list;
+}
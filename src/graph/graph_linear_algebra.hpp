@@ -0,0 +1,201 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <bit>
+#include <algorithm>
+#include <type_traits>
+#include "adjacency_matrix_graph.hpp"
+#include "../thread/thread_pool.hpp"
+#include "../error/error.hpp"
+
+// Matrix-vector kernels that run directly on AdjacencyMatrixGraph storage. A[i][j] is the weight of edge i -> j (1 for
+// bool graphs) and absent cells count as 0. Every 64-column presence word is handled as one block: sparse words walk
+// their set bits, while weighted words holding at least DenseWordEdges edges stream all 64 cells branch-free so they
+// vectorize (absent cells hold E{}). Pattern-only products always walk the bits, which beats expanding bits into lanes
+
+constexpr size_t DenseWordEdges = 16;
+constexpr size_t ProductLanes = 8;
+
+// Sum of A[row][j] * x[j] over the row; Pattern reads every edge as 1 whatever its weight.
+// Independent lane accumulators let the dense loop vectorize without reassociating one running sum
+template<bool Pattern, typename E, typename T>
+T adjacencyRowProduct(const EdgeMatrix<E>& matrix, size_t row, const T* x) {
+    constexpr size_t WordBits = EdgePresenceMatrix::WordBits;
+    const size_t vertexCount = matrix.size();
+    const uint64_t* words = matrix.presenceRow(row);
+    T lanes[ProductLanes] = {};
+    T sum{};
+    for (size_t base = 0; base < vertexCount; base += WordBits) {
+        const uint64_t word = words[base / WordBits];
+        if constexpr (!Pattern && !std::is_same_v<E, bool>) {
+            if (static_cast<size_t>(std::popcount(word)) >= DenseWordEdges && base + WordBits <= vertexCount) {
+                const E* cells = matrix.data() + row * matrix.stride() + base;
+                for (size_t k = 0; k < WordBits; k += ProductLanes) {
+                    for (size_t l = 0; l < ProductLanes; l++) lanes[l] += static_cast<T>(cells[k + l]) * x[base + k + l];
+                }
+                continue;
+            }
+        }
+        for (uint64_t rest = word; rest != 0; rest &= rest - 1) {
+            const size_t column = base + std::countr_zero(rest);
+            if constexpr (Pattern || std::is_same_v<E, bool>) sum += x[column];
+            else sum += static_cast<T>(matrix.weight(row, column)) * x[column];
+        }
+    }
+    for (T lane : lanes) sum += lane;
+    return sum;
+}
+
+// Columns [firstWord * 64, lastWord * 64) of y = A^T x. Every row is streamed once per block and each block owns its
+// slice of y, so blocks can go to different workers without atomics or a reduction
+template<bool Pattern, typename E, typename T>
+void adjacencyTransposedBlock(const EdgeMatrix<E>& matrix, const T* x, T* y, size_t firstWord, size_t lastWord) {
+    constexpr size_t WordBits = EdgePresenceMatrix::WordBits;
+    const size_t vertexCount = matrix.size();
+    std::fill(y + firstWord * WordBits, y + std::min(vertexCount, lastWord * WordBits), T{});
+    for (size_t row = 0; row < vertexCount; row++) {
+        const T scale = x[row];
+        if (scale == T{}) continue;
+        const uint64_t* words = matrix.presenceRow(row);
+        for (size_t w = firstWord; w < lastWord; w++) {
+            const uint64_t word = words[w];
+            const size_t base = w * WordBits;
+            if constexpr (!Pattern && !std::is_same_v<E, bool>) {
+                if (static_cast<size_t>(std::popcount(word)) >= DenseWordEdges && base + WordBits <= vertexCount) {
+                    const E* cells = matrix.data() + row * matrix.stride() + base;
+                    for (size_t b = 0; b < WordBits; b++) y[base + b] += static_cast<T>(cells[b]) * scale;
+                    continue;
+                }
+            }
+            for (uint64_t rest = word; rest != 0; rest &= rest - 1) {
+                const size_t column = base + std::countr_zero(rest);
+                if constexpr (Pattern || std::is_same_v<E, bool>) y[column] += scale;
+                else y[column] += static_cast<T>(matrix.weight(row, column)) * scale;
+            }
+        }
+    }
+}
+
+// y = A x, rows split across the pool
+template<bool Pattern, typename E, typename T>
+void multiplyAdjacencyRows(const EdgeMatrix<E>& matrix, const T* x, T* y, ThreadPool& pool) {
+    pool.parallelFor(0, matrix.size(), [&](size_t begin, size_t end, size_t) {
+        for (size_t row = begin; row < end; row++) y[row] = adjacencyRowProduct<Pattern>(matrix, row, x);
+    });
+}
+
+// y = A^T x, columns split across the pool in whole cache lines of presence words
+template<bool Pattern, typename E, typename T>
+void multiplyAdjacencyColumns(const EdgeMatrix<E>& matrix, const T* x, T* y, ThreadPool& pool) {
+    constexpr size_t LineWords = EdgePresenceMatrix::CacheLineSize / sizeof(uint64_t);
+    const size_t wordCount = (matrix.size() + EdgePresenceMatrix::WordBits - 1) / EdgePresenceMatrix::WordBits;
+    const size_t grainSize = std::max(LineWords, wordCount / (pool.getThreadCount() * 4) / LineWords * LineWords);
+    pool.parallelFor(0, wordCount, [&](size_t begin, size_t end, size_t) { adjacencyTransposedBlock<Pattern>(matrix, x, y, begin, end); }, grainSize);
+}
+
+template<typename V, typename E, typename T>
+std::expected<std::vector<T>, DataStructureError> multiplyAdjacency(const AdjacencyMatrixGraph<V, E>& graph, const std::vector<T>& x, ThreadPool& pool) {
+    const auto& matrix = graph.getGraph().edges;
+    if (x.size() != matrix.size()) return std::unexpected(DataStructureError::InvalidArgument);
+    std::vector<T> y(matrix.size());
+    multiplyAdjacencyRows<false>(matrix, x.data(), y.data(), pool);
+    return y;
+}
+
+template<typename V, typename E, typename T>
+std::expected<std::vector<T>, DataStructureError> multiplyAdjacencyTransposed(const AdjacencyMatrixGraph<V, E>& graph, const std::vector<T>& x, ThreadPool& pool) {
+    const auto& matrix = graph.getGraph().edges;
+    if (x.size() != matrix.size()) return std::unexpected(DataStructureError::InvalidArgument);
+    std::vector<T> y(matrix.size());
+    multiplyAdjacencyColumns<false>(matrix, x.data(), y.data(), pool);
+    return y;
+}
+
+// Sum of term(i) over [0, count) in fixed chunks added up in chunk order, so the result does not depend on scheduling
+template<typename F>
+double parallelSum(size_t count, ThreadPool& pool, F&& term) {
+    constexpr size_t ChunkSize = 4096;
+    std::vector<double> partial((count + ChunkSize - 1) / ChunkSize, 0.0);
+    pool.parallelFor(0, partial.size(), [&](size_t begin, size_t end, size_t) {
+        for (size_t c = begin; c < end; c++) {
+            double sum = 0;
+            for (size_t i = c * ChunkSize; i < std::min(count, (c + 1) * ChunkSize); i++) sum += term(i);
+            partial[c] = sum;
+        }
+    }, 1);
+    double total = 0;
+    for (double sum : partial) total += sum;
+    return total;
+}
+
+struct PageRankResult {
+    std::vector<double> ranks;
+    size_t iterations = 0;
+    double residual = 0;
+};
+
+// Power iteration r' = d * A^T D^-1 r + (d * dangling + 1 - d) * t on the edge pattern (weights are ignored): D holds
+// out-degrees, t is the teleport distribution and the rank of vertices without out-edges (dangling) is spread along t.
+// Stops once the L1 change of an iteration is at most tolerance, or after maxIterations; ranks are indexed like vertices
+template<typename V, typename E>
+std::expected<PageRankResult, DataStructureError> personalizedPageRankByIndex(const AdjacencyMatrixGraph<V, E>& graph, std::vector<double> teleport, ThreadPool& pool, double damping = 0.85, double tolerance = 1e-9, size_t maxIterations = 100) {
+    const auto& matrix = graph.getGraph().edges;
+    const size_t vertexCount = matrix.size();
+    if (vertexCount == 0) return std::unexpected(DataStructureError::ContainerIsEmpty);
+    if (teleport.size() != vertexCount || !(damping >= 0 && damping <= 1) || !(tolerance >= 0)) return std::unexpected(DataStructureError::InvalidArgument);
+    double teleportMass = 0;
+    for (double weight : teleport) {
+        if (!(weight >= 0) || std::isinf(weight)) return std::unexpected(DataStructureError::InvalidArgument);
+        teleportMass += weight;
+    }
+    if (!(teleportMass > 0) || std::isinf(teleportMass)) return std::unexpected(DataStructureError::InvalidArgument);
+    for (double& weight : teleport) weight /= teleportMass;
+    std::vector<double> inverseDegree(vertexCount);
+    pool.parallelFor(0, vertexCount, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; i++) {
+            const size_t degree = matrix.rowDegree(i);
+            inverseDegree[i] = degree == 0 ? 0.0 : 1.0 / static_cast<double>(degree);
+        }
+    });
+    // Undirected matrices are symmetric, so A^T x is the plain row product there
+    const bool symmetric = graph.getGraph().graphType == AdjacencyMatrixGraph<V, E>::GraphType::Undirected;
+    PageRankResult result{.ranks = teleport};
+    std::vector<double> scaled(vertexCount);
+    std::vector<double> next(vertexCount);
+    while (result.iterations < maxIterations) {
+        const double dangling = parallelSum(vertexCount, pool, [&](size_t i) {
+            scaled[i] = result.ranks[i] * inverseDegree[i];
+            return inverseDegree[i] == 0 ? result.ranks[i] : 0.0;
+        });
+        if (symmetric) multiplyAdjacencyRows<true>(matrix, scaled.data(), next.data(), pool);
+        else multiplyAdjacencyColumns<true>(matrix, scaled.data(), next.data(), pool);
+        const double jump = damping * dangling + 1 - damping;
+        result.residual = parallelSum(vertexCount, pool, [&](size_t i) {
+            next[i] = damping * next[i] + jump * teleport[i];
+            return std::abs(next[i] - result.ranks[i]);
+        });
+        result.ranks.swap(next);
+        result.iterations++;
+        if (result.residual <= tolerance) break;
+    }
+    return result;
+}
+
+// Random walks restart uniformly at one of sources
+template<typename V, typename E>
+std::expected<PageRankResult, DataStructureError> personalizedPageRank(const AdjacencyMatrixGraph<V, E>& graph, const std::vector<V>& sources, ThreadPool& pool, double damping = 0.85, double tolerance = 1e-9, size_t maxIterations = 100) {
+    TRY(vertexCount, graph.getVertexCount());
+    if (sources.empty()) return std::unexpected(DataStructureError::InvalidArgument);
+    std::vector<double> teleport(vertexCount, 0.0);
+    for (const V& source : sources) {
+        TRY(index, graph.getVertexIndex(source));
+        teleport[index] = 1.0;
+    }
+    return personalizedPageRankByIndex(graph, std::move(teleport), pool, damping, tolerance, maxIterations);
+}
+
+template<typename V, typename E>
+std::expected<PageRankResult, DataStructureError> pageRank(const AdjacencyMatrixGraph<V, E>& graph, ThreadPool& pool, double damping = 0.85, double tolerance = 1e-9, size_t maxIterations = 100) {
+    TRY(vertexCount, graph.getVertexCount());
+    return personalizedPageRankByIndex(graph, std::vector<double>(vertexCount, 1.0), pool, damping, tolerance, maxIterations);
+}
@@ -0,0 +1,334 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <span>
+#include <memory>
+#include <limits>
+#include <numeric>
+#include <fstream>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "csr_graph.hpp"
+#include "csr_view.hpp"
+#include "../error/error.hpp"
+
+// On-disk layout, native byte order: this header, then the vertex table, the vertex indices sorted by vertex value (for
+// lookups without building a hash table), CSR row offsets, targets and weights. Every section starts on a 64-byte boundary
+struct GraphSnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t graphType;
+    uint32_t vertexSize;
+    uint32_t weightSize;
+    uint32_t reserved;
+    uint64_t vertexCount;
+    uint64_t edgeCount;
+    uint64_t verticesOffset;
+    uint64_t vertexOrderOffset;
+    uint64_t offsetsOffset;
+    uint64_t targetsOffset;
+    uint64_t weightsOffset;
+    uint64_t fileSize;
+};
+
+inline constexpr char GraphSnapshotMagic[8] = {'D', 'S', 'G', 'R', 'A', 'P', 'H', '\0'};
+inline constexpr uint32_t GraphSnapshotVersion = 1;
+inline constexpr uint32_t GraphSnapshotByteOrder = 0x01020304;
+inline constexpr uint64_t GraphSnapshotAlignment = 64;
+
+template<typename V, typename E>
+std::expected<void, DataStructureError> writeGraphSnapshot(const CSRGraph<V, E>& csrGraph, const std::string& path) {
+    static_assert(std::is_trivially_copyable_v<V> && std::is_trivially_copyable_v<E>, "graph snapshots store vertices and weights as raw bytes");
+    static_assert(sizeof(size_t) == sizeof(uint64_t), "graph snapshots store indices as 64-bit words");
+    const auto& graph = csrGraph.getGraph();
+    const uint64_t vertexCount = graph.vertices.size();
+    const uint64_t edgeCount = graph.targets.size();
+    auto alignUp = [](uint64_t offset) { return (offset + GraphSnapshotAlignment - 1) / GraphSnapshotAlignment * GraphSnapshotAlignment; };
+    GraphSnapshotHeader header{};
+    std::memcpy(header.magic, GraphSnapshotMagic, sizeof(header.magic));
+    header.version = GraphSnapshotVersion;
+    header.byteOrder = GraphSnapshotByteOrder;
+    header.graphType = static_cast<uint32_t>(graph.graphType);
+    header.vertexSize = sizeof(V);
+    header.weightSize = sizeof(E);
+    header.vertexCount = vertexCount;
+    header.edgeCount = edgeCount;
+    header.verticesOffset = alignUp(sizeof(GraphSnapshotHeader));
+    header.vertexOrderOffset = alignUp(header.verticesOffset + vertexCount * sizeof(V));
+    header.offsetsOffset = alignUp(header.vertexOrderOffset + vertexCount * sizeof(uint64_t));
+    header.targetsOffset = alignUp(header.offsetsOffset + (vertexCount + 1) * sizeof(uint64_t));
+    header.weightsOffset = alignUp(header.targetsOffset + edgeCount * sizeof(uint64_t));
+    header.fileSize = header.weightsOffset + edgeCount * sizeof(E);
+    std::vector<uint64_t> vertexOrder(vertexCount);
+    std::iota(vertexOrder.begin(), vertexOrder.end(), 0);
+    std::sort(vertexOrder.begin(), vertexOrder.end(), [&graph](uint64_t a, uint64_t b) { return graph.vertices[a] < graph.vertices[b]; });
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) return std::unexpected(DataStructureError::FileOperationFailed);
+    auto writeSection = [&out](uint64_t offset, const void* data, size_t bytes) {
+        static const char padding[GraphSnapshotAlignment] = {};
+        out.write(padding, static_cast<std::streamsize>(offset - static_cast<uint64_t>(out.tellp())));
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    };
+    writeSection(0, &header, sizeof(header));
+    writeSection(header.verticesOffset, graph.vertices.data(), vertexCount * sizeof(V));
+    writeSection(header.vertexOrderOffset, vertexOrder.data(), vertexCount * sizeof(uint64_t));
+    writeSection(header.offsetsOffset, graph.offsets.data(), (vertexCount + 1) * sizeof(uint64_t));
+    writeSection(header.targetsOffset, graph.targets.data(), edgeCount * sizeof(uint64_t));
+    if constexpr (std::is_same_v<E, bool>) {
+        std::vector<uint8_t> weights(graph.weights.begin(), graph.weights.end());
+        writeSection(header.weightsOffset, weights.data(), edgeCount);
+    }
+    else writeSection(header.weightsOffset, graph.weights.data(), edgeCount * sizeof(E));
+    out.flush();
+    if (!out) return std::unexpected(DataStructureError::FileOperationFailed);
+    return {};
+}
+
+template<typename V, typename E>
+std::expected<void, DataStructureError> writeGraphSnapshot(const AdjacencyMatrixGraph<V, E>& matrixGraph, const std::string& path) {
+    return writeGraphSnapshot(CSRGraph<V, E>(matrixGraph), path);
+}
+
+// Read-only graph served straight from a mapped snapshot: open() validates the header, the section bounds and the row
+// offsets (O(V)), so start-up cost stays small and each query pages in just the rows it touches. Targets and the vertex
+// order are not checked until verify(), which is mandatory before querying a file that writeGraphSnapshot did not produce
+template<typename V, typename E>
+class MappedGraph {
+public:
+    using GraphType = typename AdjacencyMatrixGraph<V, E>::GraphType;
+    using ShortestPath = typename AdjacencyMatrixGraph<V, E>::ShortestPath;
+
+protected:
+    struct Unmap {
+        size_t size;
+        void operator()(const std::byte* address) const {
+#if defined(_WIN32)
+            ::UnmapViewOfFile(address);
+#else
+            ::munmap(const_cast<std::byte*>(address), size);
+#endif
+        }
+    };
+    using Mapping = std::unique_ptr<const std::byte, Unmap>;
+
+    Mapping mapping{nullptr, Unmap{0}};
+    CSRView<V, E> view;
+    std::span<const uint64_t> vertexOrder;
+    GraphType graphType = GraphType::Directed;
+
+    MappedGraph() = default;
+
+    std::expected<size_t, DataStructureError> findVertexIndex(V vertex) const {
+        auto it = std::lower_bound(vertexOrder.begin(), vertexOrder.end(), vertex, [this](uint64_t index, const V& value) { return view.vertices[index] < value; });
+        if (it == vertexOrder.end() || vertex < view.vertices[*it]) return std::unexpected(DataStructureError::ElementNotFound);
+        return static_cast<size_t>(*it);
+    }
+
+    // Maps the whole file read-only; files too short to hold a header are rejected before mapping
+    static std::expected<Mapping, DataStructureError> mapFile(const std::string& path) {
+#if defined(_WIN32)
+        HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return std::unexpected(DataStructureError::FileOperationFailed);
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(file, &size)) {
+            ::CloseHandle(file);
+            return std::unexpected(DataStructureError::FileOperationFailed);
+        }
+        const size_t fileSize = static_cast<size_t>(size.QuadPart);
+        if (fileSize < sizeof(GraphSnapshotHeader)) {
+            ::CloseHandle(file);
+            return std::unexpected(DataStructureError::InvalidFileFormat);
+        }
+        HANDLE fileMapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        ::CloseHandle(file);
+        if (fileMapping == nullptr) return std::unexpected(DataStructureError::FileOperationFailed);
+        const void* address = ::MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+        ::CloseHandle(fileMapping);
+        if (address == nullptr) return std::unexpected(DataStructureError::FileOperationFailed);
+#else
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) return std::unexpected(DataStructureError::FileOperationFailed);
+        struct stat info;
+        if (::fstat(descriptor, &info) != 0) {
+            ::close(descriptor);
+            return std::unexpected(DataStructureError::FileOperationFailed);
+        }
+        const size_t fileSize = static_cast<size_t>(info.st_size);
+        if (fileSize < sizeof(GraphSnapshotHeader)) {
+            ::close(descriptor);
+            return std::unexpected(DataStructureError::InvalidFileFormat);
+        }
+        const void* address = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor);
+        if (address == MAP_FAILED) return std::unexpected(DataStructureError::FileOperationFailed);
+#endif
+        return Mapping(static_cast<const std::byte*>(address), Unmap{fileSize});
+    }
+
+    template<typename T>
+    static std::expected<std::span<const T>, DataStructureError> section(const std::byte* base, const GraphSnapshotHeader& header, uint64_t offset, uint64_t count) {
+        if (offset % GraphSnapshotAlignment != 0 || offset > header.fileSize) return std::unexpected(DataStructureError::InvalidFileFormat);
+        if (count > (header.fileSize - offset) / sizeof(T)) return std::unexpected(DataStructureError::InvalidFileFormat);
+        return std::span<const T>(reinterpret_cast<const T*>(base + offset), count);
+    }
+
+public:
+    MappedGraph(const MappedGraph&) = delete;
+
+    MappedGraph& operator=(const MappedGraph&) = delete;
+
+    MappedGraph(MappedGraph&&) noexcept = default;
+
+    MappedGraph& operator=(MappedGraph&&) noexcept = default;
+
+    ~MappedGraph() = default;
+
+    static std::expected<MappedGraph, DataStructureError> open(const std::string& path) {
+        static_assert(std::is_trivially_copyable_v<V> && std::is_trivially_copyable_v<E>, "graph snapshots store vertices and weights as raw bytes");
+        static_assert(sizeof(size_t) == sizeof(uint64_t), "graph snapshots store indices as 64-bit words");
+        auto file = mapFile(path);
+        if (!file) return std::unexpected(file.error());
+        MappedGraph mapped;
+        mapped.mapping = std::move(*file);
+        const size_t fileSize = mapped.mapping.get_deleter().size;
+        const std::byte* base = mapped.mapping.get();
+        const auto& header = *reinterpret_cast<const GraphSnapshotHeader*>(base);
+        if (std::memcmp(header.magic, GraphSnapshotMagic, sizeof(header.magic)) != 0) return std::unexpected(DataStructureError::InvalidFileFormat);
+        if (header.version != GraphSnapshotVersion || header.byteOrder != GraphSnapshotByteOrder) return std::unexpected(DataStructureError::InvalidFileFormat);
+        if (header.vertexSize != sizeof(V) || header.weightSize != sizeof(E) || header.fileSize != fileSize) return std::unexpected(DataStructureError::InvalidFileFormat);
+        if (header.graphType > static_cast<uint32_t>(GraphType::Undirected)) return std::unexpected(DataStructureError::InvalidFileFormat);
+        if (header.vertexCount >= std::numeric_limits<uint64_t>::max() / sizeof(uint64_t)) return std::unexpected(DataStructureError::InvalidFileFormat);
+        TRY(vertexTable, section<V>(base, header, header.verticesOffset, header.vertexCount));
+        TRY(orderTable, section<uint64_t>(base, header, header.vertexOrderOffset, header.vertexCount));
+        TRY(offsetTable, section<size_t>(base, header, header.offsetsOffset, header.vertexCount + 1));
+        TRY(targetTable, section<size_t>(base, header, header.targetsOffset, header.edgeCount));
+        TRY(weightTable, section<E>(base, header, header.weightsOffset, header.edgeCount));
+        // Offsets rising from 0 to edgeCount keep every row inside the targets section
+        if (offsetTable.front() != 0 || offsetTable.back() != header.edgeCount) return std::unexpected(DataStructureError::InvalidFileFormat);
+        if (!std::ranges::is_sorted(offsetTable)) return std::unexpected(DataStructureError::InvalidFileFormat);
+        mapped.view = {vertexTable, offsetTable, targetTable, weightTable};
+        mapped.vertexOrder = orderTable;
+        mapped.graphType = static_cast<GraphType>(header.graphType);
+        return mapped;
+    }
+
+    // O(V + E) check of what open() leaves alone: targets in range and ascending per row, and a vertex order that sorts the
+    // vertex table. Queries on a file that fails it may read out of bounds
+    std::expected<void, DataStructureError> verify() const {
+        const auto& vertices = view.vertices;
+        const auto& offsets = view.offsets;
+        const auto& targets = view.targets;
+        const size_t vertexCount = vertices.size();
+        for (size_t i = 0; i < vertexCount; i++) {
+            for (size_t k = offsets[i]; k < offsets[i + 1]; k++) {
+                if (targets[k] >= vertexCount || (k > offsets[i] && targets[k] <= targets[k - 1])) return std::unexpected(DataStructureError::InvalidFileFormat);
+            }
+        }
+        for (size_t i = 0; i < vertexCount; i++) {
+            if (vertexOrder[i] >= vertexCount) return std::unexpected(DataStructureError::InvalidFileFormat);
+            if (i > 0 && !(vertices[vertexOrder[i - 1]] < vertices[vertexOrder[i]])) return std::unexpected(DataStructureError::InvalidFileFormat);
+        }
+        return {};
+    }
+
+    bool isEmpty() const { return view.vertices.empty(); }
+
+    GraphType getGraphType() const { return graphType; }
+
+    std::span<const V> getVertexTable() const { return view.vertices; }
+
+    bool hasVertex(V vertex) const { return findVertexIndex(vertex).has_value(); }
+
+    std::expected<size_t, DataStructureError> getVertexIndex(V vertex) const { return findVertexIndex(vertex); }
+
+    bool hasEdge(V start, V end) const {
+        auto startIndex = findVertexIndex(start);
+        auto endIndex = findVertexIndex(end);
+        if (!startIndex || !endIndex) return false;
+        return view.findEdgePosition(*startIndex, *endIndex).has_value();
+    }
+
+    std::expected<E, DataStructureError> getEdge(V start, V end) const {
+        TRY(startIndex, findVertexIndex(start));
+        TRY(endIndex, findVertexIndex(end));
+        TRY(position, view.findEdgePosition(startIndex, endIndex));
+        return view.weights[position];
+    }
+
+    std::expected<std::vector<V>, DataStructureError> getNeighbours(V vertex, std::function<void(V)> visitor) const {
+        TRY(index, findVertexIndex(vertex));
+        return view.neighbours(index, visitor);
+    }
+
+    std::expected<size_t, DataStructureError> getOutDegree(V vertex) const {
+        TRY(index, findVertexIndex(vertex));
+        return view.offsets[index + 1] - view.offsets[index];
+    }
+
+    std::expected<size_t, DataStructureError> getVertexCount() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        return view.vertices.size();
+    }
+
+    std::expected<size_t, DataStructureError> getEdgeCount() const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        return view.targets.size();
+    }
+
+    std::expected<std::vector<V>, DataStructureError> DFSRecursive(V start, std::function<void(V)> visitor) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        return view.DFSRecursive(startIndex, visitor);
+    }
+
+    std::expected<std::vector<V>, DataStructureError> DFSIterative(V start, std::function<void(V)> visitor) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        return view.DFSIterative(startIndex, visitor);
+    }
+
+    std::expected<std::vector<V>, DataStructureError> BFS(V start, std::function<void(V)> visitor) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        return view.BFS(startIndex, visitor);
+    }
+
+    std::expected<bool, DataStructureError> hasPath(V start, V end) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        TRY(endIndex, findVertexIndex(end));
+        return view.hasPath(startIndex, endIndex);
+    }
+
+    std::expected<std::vector<E>, DataStructureError> Dijkstra(V start) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(startIndex, findVertexIndex(start));
+        return view.Dijkstra(startIndex);
+    }
+
+    // Dijkstra from source that stops as soon as target is settled
+    std::expected<ShortestPath, DataStructureError> shortestPath(V source, V target) const {
+        if (isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+        TRY(sourceIndex, findVertexIndex(source));
+        TRY(targetIndex, findVertexIndex(target));
+        return view.shortestPath(sourceIndex, targetIndex);
+    }
+};
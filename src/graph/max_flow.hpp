@@ -0,0 +1,297 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+#include "adjacency_matrix_graph.hpp"
+#include "../error/error.hpp"
+
+enum class MaxFlowAlgorithm {
+    Dinic,
+    PushRelabel
+};
+
+template<typename V, typename E>
+struct MaxFlowResult {
+    using Edge = typename AdjacencyMatrixGraph<V, E>::Edge;
+    E value;
+    std::vector<Edge> flows;        // every stored edge with the flow it carries; undirected edges once, oriented along their flow
+    std::vector<bool> sourceSide;   // minimum cut: vertices still reachable from the source in the residual network
+    std::vector<Edge> cutEdges;     // edges from the source side to the sink side, saturated; their capacities add up to value
+};
+
+// Residual network laid out once from the presence bits: every adjacent pair {i, j} gets two paired arcs stored with their
+// tails (i -> j carrying c(i, j) and j -> i carrying c(j, i), 0 for a missing direction), so a vertex scans only its own
+// neighbours instead of a whole matrix row, and antiparallel edges share one pair
+template<typename E>
+struct FlowNetwork {
+    std::vector<size_t> offsets;
+    std::vector<size_t> heads;
+    std::vector<size_t> reverse;
+    std::vector<E> residual;
+
+    size_t vertexCount() const { return offsets.size() - 1; }
+
+    static std::expected<FlowNetwork, DataStructureError> build(const EdgeMatrix<E>& matrix) {
+        const size_t vertexCount = matrix.size();
+        FlowNetwork network;
+        network.offsets.assign(vertexCount + 1, 0);
+        auto ownsPair = [&](size_t i, size_t j) { return i != j && (i < j || !matrix.hasEdge(j, i)); };
+        for (size_t i = 0; i < vertexCount; i++) {
+            bool negative = false;
+            matrix.forEachNeighbour(i, [&](size_t j) {
+                negative |= matrix.weight(i, j) < E{};
+                if (!ownsPair(i, j)) return;
+                network.offsets[i + 1]++;
+                network.offsets[j + 1]++;
+            });
+            if (negative) return std::unexpected(DataStructureError::InvalidArgument);
+        }
+        for (size_t i = 0; i < vertexCount; i++) network.offsets[i + 1] += network.offsets[i];
+        const size_t arcCount = network.offsets[vertexCount];
+        network.heads.resize(arcCount);
+        network.reverse.resize(arcCount);
+        network.residual.resize(arcCount);
+        std::vector<size_t> cursor(network.offsets.begin(), network.offsets.end() - 1);
+        for (size_t i = 0; i < vertexCount; i++) {
+            matrix.forEachNeighbour(i, [&](size_t j) {
+                if (!ownsPair(i, j)) return;
+                const size_t forward = cursor[i]++;
+                const size_t backward = cursor[j]++;
+                network.heads[forward] = j;
+                network.heads[backward] = i;
+                network.reverse[forward] = backward;
+                network.reverse[backward] = forward;
+                network.residual[forward] = matrix.weight(i, j);
+                network.residual[backward] = matrix.hasEdge(j, i) ? matrix.weight(j, i) : E{};
+            });
+        }
+        return network;
+    }
+
+    void push(size_t arc, E amount) {
+        residual[arc] -= amount;
+        residual[reverse[arc]] += amount;
+    }
+
+    // Vertices reachable from source over arcs with residual capacity left
+    std::vector<bool> reachableFrom(size_t source) const {
+        std::vector<bool> reached(vertexCount(), false);
+        std::vector<size_t> queue{source};
+        reached[source] = true;
+        for (size_t head = 0; head < queue.size(); head++) {
+            for (size_t arc = offsets[queue[head]]; arc < offsets[queue[head] + 1]; arc++) {
+                if (residual[arc] > E{} && !reached[heads[arc]]) {
+                    reached[heads[arc]] = true;
+                    queue.push_back(heads[arc]);
+                }
+            }
+        }
+        return reached;
+    }
+};
+
+// Dinic: BFS level graph from the source, then blocking flows found by an iterative DFS with current-arc pointers;
+// after an augmentation the search resumes from the tail of the first saturated arc instead of the source
+template<typename E>
+E dinicFlow(FlowNetwork<E>& network, size_t source, size_t sink) {
+    const size_t vertexCount = network.vertexCount();
+    constexpr size_t Unreached = std::numeric_limits<size_t>::max();
+    std::vector<size_t> level(vertexCount);
+    std::vector<size_t> current(vertexCount);
+    std::vector<size_t> queue;
+    std::vector<size_t> path;
+    queue.reserve(vertexCount);
+    E total{};
+    while (true) {
+        std::fill(level.begin(), level.end(), Unreached);
+        level[source] = 0;
+        queue.assign(1, source);
+        for (size_t head = 0; head < queue.size() && level[sink] == Unreached; head++) {
+            const size_t vertex = queue[head];
+            for (size_t arc = network.offsets[vertex]; arc < network.offsets[vertex + 1]; arc++) {
+                if (network.residual[arc] > E{} && level[network.heads[arc]] == Unreached) {
+                    level[network.heads[arc]] = level[vertex] + 1;
+                    queue.push_back(network.heads[arc]);
+                }
+            }
+        }
+        if (level[sink] == Unreached) return total;
+        std::copy(network.offsets.begin(), network.offsets.end() - 1, current.begin());
+        path.clear();
+        size_t vertex = source;
+        while (true) {
+            if (vertex == sink) {
+                E bottleneck = network.residual[path[0]];
+                for (size_t arc : path) bottleneck = std::min(bottleneck, network.residual[arc]);
+                size_t saturated = path.size();
+                for (size_t k = 0; k < path.size(); k++) {
+                    network.push(path[k], bottleneck);
+                    if (saturated == path.size() && !(network.residual[path[k]] > E{})) saturated = k;
+                }
+                total += bottleneck;
+                path.resize(saturated);
+                vertex = path.empty() ? source : network.heads[path.back()];
+                continue;
+            }
+            size_t& arc = current[vertex];
+            while (arc < network.offsets[vertex + 1] && !(network.residual[arc] > E{} && level[network.heads[arc]] == level[vertex] + 1)) arc++;
+            if (arc < network.offsets[vertex + 1]) {
+                path.push_back(arc);
+                vertex = network.heads[arc];
+                continue;
+            }
+            // Dead end: drop vertex from the level graph and retreat one arc
+            level[vertex] = Unreached;
+            if (path.empty()) break;
+            path.pop_back();
+            vertex = path.empty() ? source : network.heads[path.back()];
+            current[vertex]++;
+        }
+    }
+}
+
+// Highest-label push-relabel (Goldberg and Tarjan) in a single phase: heights below V measure residual distance to the
+// sink, heights from V up measure V + distance back to the source, so leftover excess drains home and the preflow ends as
+// a flow. Periodic global relabels recompute exact distances by BFS, and the gap heuristic lifts every vertex above an
+// emptied height below V straight to V + 1
+template<typename E>
+E pushRelabelFlow(FlowNetwork<E>& network, size_t source, size_t sink) {
+    const size_t vertexCount = network.vertexCount();
+    const size_t unlabelled = 2 * vertexCount;
+    std::vector<size_t> height(vertexCount, 0);
+    std::vector<E> excess(vertexCount, E{});
+    std::vector<size_t> current(network.offsets.begin(), network.offsets.end() - 1);
+    std::vector<size_t> heightCount(vertexCount, 0);
+    std::vector<std::vector<size_t>> buckets(unlabelled + 1);
+    std::vector<size_t> queue;
+    queue.reserve(vertexCount);
+    size_t highest = 0;
+    size_t relabels = 0;
+    auto isActive = [&](size_t vertex) { return vertex != source && vertex != sink && excess[vertex] > E{}; };
+    auto activate = [&](size_t vertex) {
+        buckets[height[vertex]].push_back(vertex);
+        highest = std::max(highest, height[vertex]);
+    };
+    // Exact labels by two reverse BFS passes over arcs that still have residual capacity: first from the sink, then from the source
+    auto globalRelabel = [&] {
+        std::fill(height.begin(), height.end(), unlabelled);
+        for (auto [root, base] : {std::pair{sink, size_t{0}}, std::pair{source, vertexCount}}) {
+            height[root] = base;
+            queue.assign(1, root);
+            for (size_t head = 0; head < queue.size(); head++) {
+                const size_t vertex = queue[head];
+                for (size_t arc = network.offsets[vertex]; arc < network.offsets[vertex + 1]; arc++) {
+                    const size_t tail = network.heads[arc];
+                    if (tail == source || height[tail] != unlabelled || !(network.residual[network.reverse[arc]] > E{})) continue;
+                    height[tail] = height[vertex] + 1;
+                    queue.push_back(tail);
+                }
+            }
+        }
+        std::fill(heightCount.begin(), heightCount.end(), 0);
+        for (auto& bucket : buckets) bucket.clear();
+        highest = 0;
+        for (size_t vertex = 0; vertex < vertexCount; vertex++) {
+            current[vertex] = network.offsets[vertex];
+            if (height[vertex] < vertexCount) heightCount[height[vertex]]++;
+            if (isActive(vertex)) activate(vertex);
+        }
+        relabels = 0;
+    };
+    height[source] = vertexCount;
+    for (size_t arc = network.offsets[source]; arc < network.offsets[source + 1]; arc++) {
+        const E amount = network.residual[arc];
+        if (!(amount > E{})) continue;
+        network.push(arc, amount);
+        excess[network.heads[arc]] += amount;
+        excess[source] -= amount;
+    }
+    globalRelabel();
+    while (true) {
+        while (highest > 0 && buckets[highest].empty()) highest--;
+        if (buckets[highest].empty()) break;
+        const size_t vertex = buckets[highest].back();
+        buckets[highest].pop_back();
+        // Entries left behind by a gap lift are stale: the vertex was queued again at its new height
+        if (height[vertex] != highest || !isActive(vertex)) continue;
+        while (excess[vertex] > E{}) {
+            size_t& arc = current[vertex];
+            if (arc == network.offsets[vertex + 1]) {
+                size_t newHeight = unlabelled;
+                for (size_t k = network.offsets[vertex]; k < network.offsets[vertex + 1]; k++) {
+                    if (network.residual[k] > E{}) newHeight = std::min(newHeight, height[network.heads[k]] + 1);
+                }
+                const size_t oldHeight = height[vertex];
+                height[vertex] = newHeight;
+                arc = network.offsets[vertex];
+                if (oldHeight < vertexCount) heightCount[oldHeight]--;
+                if (newHeight < vertexCount) heightCount[newHeight]++;
+                if (oldHeight < vertexCount && heightCount[oldHeight] == 0) {
+                    for (size_t other = 0; other < vertexCount; other++) {
+                        if (height[other] <= oldHeight || height[other] >= vertexCount) continue;
+                        heightCount[height[other]]--;
+                        height[other] = vertexCount + 1;
+                        current[other] = network.offsets[other];
+                        if (other != vertex && isActive(other)) activate(other);
+                    }
+                }
+                if (++relabels >= vertexCount) {
+                    globalRelabel();
+                    break;
+                }
+                if (height[vertex] >= unlabelled) break;
+                continue;
+            }
+            const size_t head = network.heads[arc];
+            if (network.residual[arc] > E{} && height[vertex] == height[head] + 1) {
+                const E amount = std::min(excess[vertex], network.residual[arc]);
+                const bool wasActive = isActive(head);
+                network.push(arc, amount);
+                excess[vertex] -= amount;
+                excess[head] += amount;
+                if (!wasActive && isActive(head)) activate(head);
+                if (excess[vertex] > E{}) arc++;
+            }
+            else arc++;
+        }
+    }
+    return excess[sink];
+}
+
+// Maximum source -> sink flow over the edge weights as capacities (undirected edges carry their capacity either way),
+// with per-edge flows and a minimum cut. Capacities must be non-negative
+template<typename V, typename E>
+std::expected<MaxFlowResult<V, E>, DataStructureError> maxFlowByIndex(const AdjacencyMatrixGraph<V, E>& graph, size_t source, size_t sink, MaxFlowAlgorithm algorithm = MaxFlowAlgorithm::PushRelabel) {
+    static_assert(std::is_arithmetic_v<E> && !std::is_same_v<E, bool>, "max flow needs numeric capacities");
+    using GraphType = typename AdjacencyMatrixGraph<V, E>::GraphType;
+    const auto& matrix = graph.getGraph().edges;
+    if (graph.isEmpty()) return std::unexpected(DataStructureError::ContainerIsEmpty);
+    if (source >= matrix.size() || sink >= matrix.size()) return std::unexpected(DataStructureError::IndexOutOfRange);
+    if (source == sink) return std::unexpected(DataStructureError::InvalidArgument);
+    TRY(network, FlowNetwork<E>::build(matrix));
+    MaxFlowResult<V, E> result;
+    result.value = algorithm == MaxFlowAlgorithm::Dinic ? dinicFlow(network, source, sink) : pushRelabelFlow(network, source, sink);
+    result.sourceSide = network.reachableFrom(source);
+    const bool undirected = graph.getGraph().graphType == GraphType::Undirected;
+    for (size_t i = 0; i < matrix.size(); i++) {
+        for (size_t arc = network.offsets[i]; arc < network.offsets[i + 1]; arc++) {
+            const size_t j = network.heads[arc];
+            if (!matrix.hasEdge(i, j)) continue;
+            const E capacity = matrix.weight(i, j);
+            // Net flow i -> j; the paired arc started at c(i, j), so whatever it lost crossed from i to j
+            const E flow = capacity - network.residual[arc];
+            if (result.sourceSide[i] && !result.sourceSide[j]) result.cutEdges.push_back({i, j, capacity});
+            if (!undirected) result.flows.push_back({i, j, flow > E{} ? flow : E{}});
+            else if (flow > E{} || (!(flow < E{}) && i < j)) result.flows.push_back({i, j, flow});
+        }
+    }
+    return result;
+}
+
+template<typename V, typename E>
+std::expected<MaxFlowResult<V, E>, DataStructureError> maxFlow(const AdjacencyMatrixGraph<V, E>& graph, V source, V sink, MaxFlowAlgorithm algorithm = MaxFlowAlgorithm::PushRelabel) {
+    TRY(sourceIndex, graph.getVertexIndex(source));
+    TRY(sinkIndex, graph.getVertexIndex(sink));
+    return maxFlowByIndex(graph, sourceIndex, sinkIndex, algorithm);
+}
@@ -6,6 +6,9 @@
 #include <expected>
 #include "../error/error.hpp"
 
+// Explicitly seeded engine for reproducible workloads (graph generators, benchmarks); rand_int / rand_sample stay time-seeded
+using RandomEngine = std::mt19937_64;
+
 inline std::expected<int, DataStructureError> rand_int(int min, int max) {
     if (min > max) return std::unexpected(DataStructureError::InvalidArgument);
     static std::mt19937 gen(static_cast<unsigned>(
@@ -28,4 +31,4 @@ inline std::expected<std::vector<int>, DataStructureError> rand_sample(int min,
         ))
     );
     return std::vector<int>(pool.begin(), pool.begin() + count);
-}
\ No newline at end of file
+}
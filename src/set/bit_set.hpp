@@ -0,0 +1,76 @@
+#pragma once
+#include <vector>
+#include <bit>
+#include <algorithm>
+#include <cstdint>
+#include <atomic>
+#include "../error/error.hpp"
+
+class BitSet {
+public:
+    static constexpr size_t WordBits = 64;
+
+protected:
+    std::vector<uint64_t> words;
+    size_t bitCount;
+
+public:
+    explicit BitSet(size_t size = 0) : words((size + WordBits - 1) / WordBits, 0), bitCount(size) {}
+
+    ~BitSet() = default;
+
+    size_t size() const { return bitCount; }
+
+    size_t wordCount() const { return words.size(); }
+
+    const uint64_t* data() const { return words.data(); }
+
+    uint64_t* data() { return words.data(); }
+
+    bool test(size_t index) const { return (words[index / WordBits] >> (index % WordBits)) & 1; }
+
+    void set(size_t index) { words[index / WordBits] |= uint64_t{1} << (index % WordBits); }
+
+    void reset(size_t index) { words[index / WordBits] &= ~(uint64_t{1} << (index % WordBits)); }
+
+    // Sets the bit and reports whether it was clear before, so "visit if unvisited" is a single call
+    bool testAndSet(size_t index) {
+        uint64_t& word = words[index / WordBits];
+        uint64_t mask = uint64_t{1} << (index % WordBits);
+        if (word & mask) return false;
+        word |= mask;
+        return true;
+    }
+
+    // Safe to call concurrently with other atomic operations on the same set
+    bool atomicTestAndSet(size_t index) {
+        uint64_t mask = uint64_t{1} << (index % WordBits);
+        return (std::atomic_ref<uint64_t>(words[index / WordBits]).fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+    }
+
+    size_t count() const {
+        size_t total = 0;
+        for (uint64_t word : words) total += std::popcount(word);
+        return total;
+    }
+
+    // Index of the first set bit at or after from, or size() if there is none
+    size_t findNext(size_t from) const {
+        if (from >= bitCount) return bitCount;
+        size_t wordIndex = from / WordBits;
+        uint64_t word = words[wordIndex] & (~uint64_t{0} << (from % WordBits));
+        while (word == 0) {
+            if (++wordIndex == words.size()) return bitCount;
+            word = words[wordIndex];
+        }
+        return wordIndex * WordBits + std::countr_zero(word);
+    }
+
+    void resize(size_t size) {
+        words.resize((size + WordBits - 1) / WordBits, 0);
+        if (size < bitCount && size % WordBits != 0) words.back() &= (uint64_t{1} << (size % WordBits)) - 1;
+        bitCount = size;
+    }
+
+    void clear() { std::fill(words.begin(), words.end(), 0); }
+};
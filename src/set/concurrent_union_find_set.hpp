@@ -0,0 +1,109 @@
+#pragma once
+#include <vector>
+#include <span>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <cstdint>
+#include "../thread/thread_pool.hpp"
+
+// Union-find over 0 .. n-1 that any number of threads can use at once (Jayanti and Tarjan). Every parent is an atomic
+// word: unite links one root under another with a single CAS and retries only if that root was linked meanwhile, and
+// find splits the path with one CAS attempt per step whose failure is simply ignored, so finds are wait-free. Roots are
+// linked by a fixed pseudo-random priority per element, which keeps trees shallow without a rank word to keep in sync
+class ConcurrentUnionFindSet {
+protected:
+    std::vector<std::atomic<size_t>> parent;
+
+    // splitmix64 finaliser: a bijection, so two elements never tie and every link goes strictly up in priority
+    static uint64_t priority(size_t element) {
+        uint64_t x = static_cast<uint64_t>(element) + 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+public:
+    explicit ConcurrentUnionFindSet(size_t size = 0) : parent(size) {
+        for (size_t i = 0; i < size; i++) parent[i].store(i, std::memory_order_relaxed);
+    }
+
+    size_t size() const { return parent.size(); }
+
+    size_t find(size_t element) {
+        while (true) {
+            const size_t up = parent[element].load(std::memory_order_acquire);
+            if (up == element) return element;
+            size_t grandparent = parent[up].load(std::memory_order_acquire);
+            if (grandparent != up) {
+                size_t expected = up;
+                parent[element].compare_exchange_weak(expected, grandparent, std::memory_order_acq_rel, std::memory_order_relaxed);
+            }
+            element = up;
+        }
+    }
+
+    // True if this call joined two different sets
+    bool unite(size_t a, size_t b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return false;
+            if (priority(a) > priority(b)) std::swap(a, b);
+            size_t expected = a;
+            if (parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel, std::memory_order_relaxed)) return true;
+        }
+    }
+
+    // Linearizable: different roots only count if the first one was still a root after both finds
+    bool isConnected(size_t a, size_t b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return true;
+            if (parent[a].load(std::memory_order_acquire) == a) return false;
+        }
+    }
+
+    // Unites every pair across the pool and returns the number of merges
+    size_t unite(std::span<const std::pair<size_t, size_t>> pairs, ThreadPool& pool) {
+        std::atomic<size_t> merges{0};
+        pool.parallelFor(0, pairs.size(), [&](size_t begin, size_t end, size_t) {
+            size_t local = 0;
+            for (size_t k = begin; k < end; k++) local += unite(pairs[k].first, pairs[k].second);
+            merges.fetch_add(local, std::memory_order_relaxed);
+        });
+        return merges.load();
+    }
+
+    void find(std::span<const size_t> elements, std::span<size_t> roots, ThreadPool& pool) {
+        pool.parallelFor(0, elements.size(), [&](size_t begin, size_t end, size_t) {
+            for (size_t k = begin; k < end; k++) roots[k] = find(elements[k]);
+        });
+    }
+
+    // The queries below read a snapshot: call them while no unite is running
+
+    size_t getSetCount() const {
+        size_t count = 0;
+        for (size_t i = 0; i < parent.size(); i++) count += parent[i].load(std::memory_order_relaxed) == i;
+        return count;
+    }
+
+    // Set id per element, numbered 0, 1, ... in order of each set's smallest element
+    std::vector<size_t> labels(ThreadPool& pool) {
+        const size_t elementCount = parent.size();
+        std::vector<size_t> roots(elementCount);
+        pool.parallelFor(0, elementCount, [&](size_t begin, size_t end, size_t) {
+            for (size_t i = begin; i < end; i++) roots[i] = find(i);
+        });
+        constexpr size_t Unassigned = std::numeric_limits<size_t>::max();
+        std::vector<size_t> rootLabel(elementCount, Unassigned);
+        size_t next = 0;
+        for (size_t i = 0; i < elementCount; i++) {
+            if (rootLabel[roots[i]] == Unassigned) rootLabel[roots[i]] = next++;
+            roots[i] = rootLabel[roots[i]];
+        }
+        return roots;
+    }
+};
@@ -1,5 +1,11 @@
+#pragma once
 #include <vector>
+#include <span>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
 #include <algorithm>
+#include <unordered_map>
 #include "../error/error.hpp"
 
 template<typename T>
@@ -8,24 +14,31 @@ public:
     std::vector<T> elements;
     std::vector<size_t> parent;
     std::vector<size_t> deepth;
+    std::unordered_map<T, size_t> elementIndex;
 
     UnionFindSet(const std::vector<T>& elems) {
         elements = elems;
         parent.resize(elems.size());
         for (size_t i = 0; i < elems.size(); i++) parent[i] = i;
         deepth.resize(elems.size(), 1);
+        elementIndex.reserve(elems.size());
+        for (size_t i = 0; i < elems.size(); i++) elementIndex.emplace(elems[i], i);
     }
 
     ~UnionFindSet() {
         elements.clear();
         parent.clear();
         deepth.clear();
+        elementIndex.clear();
     }
 
-    std::expected<T, DataStructureError> find(T elem) {
-        auto it = std::find(elements.begin(), elements.end(), elem);
-        if (it == elements.end()) return std::unexpected(DataStructureError::ElementNotFound);
-        size_t index = std::distance(elements.begin(), it);
+    std::expected<size_t, DataStructureError> indexOf(const T& elem) const {
+        auto it = elementIndex.find(elem);
+        if (it == elementIndex.end()) return std::unexpected(DataStructureError::ElementNotFound);
+        return it->second;
+    }
+
+    size_t findIndex(size_t index) {
         size_t root = index;
         while (parent[root] != root) root = parent[root];
         while (parent[index] != root) {
@@ -33,30 +46,226 @@ public:
             parent[index] = root;
             index = next;
         }
-        return elements[root];
+        return root;
+    }
+
+    std::expected<T, DataStructureError> find(T elem) {
+        TRY(index, indexOf(elem));
+        return elements[findIndex(index)];
     }
 
     std::expected<void, DataStructureError> unionSet(T set1, T set2) {
-        TRY(root1, find(set1));
-        TRY(root2, find(set2));
+        TRY(index1, indexOf(set1));
+        TRY(index2, indexOf(set2));
+        size_t root1 = findIndex(index1);
+        size_t root2 = findIndex(index2);
         if (root1 == root2) return {};
-        auto it1 = std::find(elements.begin(), elements.end(), root1);
-        auto it2 = std::find(elements.begin(), elements.end(), root2);
-        size_t index1 = std::distance(elements.begin(), it1);
-        size_t index2 = std::distance(elements.begin(), it2);
-        if (deepth[index1] > deepth[index2]) parent[index2] = index1;
-        else if (deepth[index1] < deepth[index2]) parent[index1] = index2;
+        if (deepth[root1] > deepth[root2]) parent[root2] = root1;
+        else if (deepth[root1] < deepth[root2]) parent[root1] = root2;
         else {
-            parent[index2] = index1;
-            deepth[index1]++;
+            parent[root2] = root1;
+            deepth[root1]++;
         }
         return {};
     }
 
     std::expected<void, DataStructureError> isConnected(T elem1, T elem2) {
-        TRY(root1, find(elem1));
-        TRY(root2, find(elem2));
-        if (root1 == root2) return {};
+        TRY(index1, indexOf(elem1));
+        TRY(index2, indexOf(elem2));
+        if (findIndex(index1) == findIndex(index2)) return {};
         else return std::unexpected(DataStructureError::InvalidOperation);
     }
-};
\ No newline at end of file
+
+    // Representative of every element in elems, in order; fails without side effects if any element is unknown
+    std::expected<std::vector<T>, DataStructureError> find(std::span<const T> elems) {
+        std::vector<size_t> indices;
+        indices.reserve(elems.size());
+        for (const T& elem : elems) {
+            TRY(index, indexOf(elem));
+            indices.push_back(index);
+        }
+        std::vector<T> roots;
+        roots.reserve(elems.size());
+        for (size_t index : indices) roots.push_back(elements[findIndex(index)]);
+        return roots;
+    }
+
+    // Unites every pair in order and returns how many of them joined two different sets
+    std::expected<size_t, DataStructureError> unionSet(std::span<const std::pair<T, T>> pairs) {
+        for (const auto& [first, second] : pairs) {
+            if (!elementIndex.contains(first) || !elementIndex.contains(second)) return std::unexpected(DataStructureError::ElementNotFound);
+        }
+        size_t merged = 0;
+        for (const auto& [first, second] : pairs) {
+            size_t root1 = findIndex(elementIndex.find(first)->second);
+            size_t root2 = findIndex(elementIndex.find(second)->second);
+            if (root1 == root2) continue;
+            if (deepth[root1] < deepth[root2]) std::swap(root1, root2);
+            parent[root2] = root1;
+            if (deepth[root1] == deepth[root2]) deepth[root1]++;
+            merged++;
+        }
+        return merged;
+    }
+};
+
+// Union-find over the integers 0 .. n-1, so there is nothing to translate: one packed array holds the parent of every
+// element, or minus the set size at a root. Union by size plus path halving; indices are not range checked
+class DenseUnionFindSet {
+protected:
+    std::vector<std::ptrdiff_t> link;
+    size_t setCount = 0;
+
+public:
+    explicit DenseUnionFindSet(size_t size = 0) : link(size, -1), setCount(size) {}
+
+    size_t size() const { return link.size(); }
+
+    size_t getSetCount() const { return setCount; }
+
+    void reset(size_t size) {
+        link.assign(size, -1);
+        setCount = size;
+    }
+
+    // New singleton set holding the next integer
+    size_t addElement() {
+        link.push_back(-1);
+        setCount++;
+        return link.size() - 1;
+    }
+
+    // Drops element, which must be a singleton set, and renames the last element to it (the EdgeMatrix::swapRemove order)
+    void swapRemove(size_t element) {
+        const size_t last = link.size() - 1;
+        for (auto& entry : link) if (entry == static_cast<std::ptrdiff_t>(last)) entry = static_cast<std::ptrdiff_t>(element);
+        link[element] = link[last];
+        link.pop_back();
+        setCount--;
+    }
+
+    size_t find(size_t element) {
+        while (link[element] >= 0) {
+            const size_t parent = static_cast<size_t>(link[element]);
+            if (link[parent] >= 0) link[element] = link[parent];
+            element = parent;
+        }
+        return element;
+    }
+
+    // Walks without halving so const readers never write; union by size keeps every chain within log2(n) steps
+    size_t find(size_t element) const {
+        while (link[element] >= 0) element = static_cast<size_t>(link[element]);
+        return element;
+    }
+
+    // True if a and b were in different sets
+    bool unite(size_t a, size_t b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        if (link[a] > link[b]) std::swap(a, b);
+        link[a] += link[b];
+        link[b] = static_cast<std::ptrdiff_t>(a);
+        setCount--;
+        return true;
+    }
+
+    bool isConnected(size_t a, size_t b) const { return find(a) == find(b); }
+
+    size_t setSize(size_t element) const { return static_cast<size_t>(-link[find(element)]); }
+
+    // roots[k] = find(elements[k]); the halving done by earlier lookups shortens the later ones
+    void find(std::span<const size_t> elements, std::span<size_t> roots) {
+        for (size_t k = 0; k < elements.size(); k++) roots[k] = find(elements[k]);
+    }
+
+    // Unites pairs in order; merged[k], when given, records whether pair k joined two sets, which is exactly the edge
+    // selection of a Kruskal loop over pairs sorted by weight. Returns the number of merges
+    size_t unite(std::span<const std::pair<size_t, size_t>> pairs, std::span<uint8_t> merged = {}) {
+        size_t merges = 0;
+        for (size_t k = 0; k < pairs.size(); k++) {
+            const bool joined = unite(pairs[k].first, pairs[k].second);
+            if (!merged.empty()) merged[k] = joined;
+            merges += joined;
+        }
+        return merges;
+    }
+
+    // Moves part, a proper subset of one set, into a set of its own and relinks the rest of that set, which may have
+    // pointed through part; one O(n) pass, for callers that learn about a split after the fact
+    void splitOff(std::span<const size_t> part) {
+        const size_t oldRoot = find(part[0]);
+        const size_t oldSize = setSize(oldRoot);
+        std::vector<uint8_t> inPart(link.size(), 0);
+        for (size_t element : part) inPart[element] = 1;
+        std::vector<size_t> rest;
+        for (size_t element = 0; element < link.size(); element++) {
+            if (!inPart[element] && find(element) == oldRoot) rest.push_back(element);
+        }
+        for (size_t element : part) link[element] = static_cast<std::ptrdiff_t>(part[0]);
+        for (size_t element : rest) link[element] = static_cast<std::ptrdiff_t>(rest[0]);
+        link[part[0]] = -static_cast<std::ptrdiff_t>(part.size());
+        link[rest[0]] = -static_cast<std::ptrdiff_t>(oldSize - part.size());
+        setCount++;
+    }
+};
+
+// Union-find whose unions can be undone in LIFO order: union by rank and no path compression, so every unite changes at
+// most two words and find stays within log2(n) steps. checkpoint() marks the current state and rollback() returns to it
+class RollbackUnionFindSet {
+protected:
+    struct Change {
+        size_t child;
+        bool rankGrew;
+    };
+
+    std::vector<size_t> parent;
+    std::vector<uint8_t> rank;
+    std::vector<Change> history;
+    size_t setCount = 0;
+
+public:
+    explicit RollbackUnionFindSet(size_t size = 0) : parent(size), rank(size, 0), setCount(size) {
+        for (size_t i = 0; i < size; i++) parent[i] = i;
+    }
+
+    size_t size() const { return parent.size(); }
+
+    size_t getSetCount() const { return setCount; }
+
+    size_t find(size_t element) const {
+        while (parent[element] != element) element = parent[element];
+        return element;
+    }
+
+    // True if a and b were in different sets; only merges are logged
+    bool unite(size_t a, size_t b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        if (rank[a] < rank[b]) std::swap(a, b);
+        const bool rankGrew = rank[a] == rank[b];
+        parent[b] = a;
+        rank[a] += rankGrew;
+        history.push_back({b, rankGrew});
+        setCount--;
+        return true;
+    }
+
+    bool isConnected(size_t a, size_t b) const { return find(a) == find(b); }
+
+    size_t checkpoint() const { return history.size(); }
+
+    // Undoes every merge made since checkpoint was taken, newest first
+    void rollback(size_t checkpoint) {
+        while (history.size() > checkpoint) {
+            const Change change = history.back();
+            history.pop_back();
+            const size_t root = parent[change.child];
+            rank[root] -= change.rankGrew;
+            parent[change.child] = change.child;
+            setCount++;
+        }
+    }
+};
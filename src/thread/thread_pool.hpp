@@ -0,0 +1,96 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <algorithm>
+
+// Fixed set of workers that run one job at a time; the calling thread takes part as worker 0
+class ThreadPool {
+protected:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable finished;
+    std::function<void(size_t)> task;
+    size_t generation = 0;
+    size_t pending = 0;
+    bool stopping = false;
+
+    void workerLoop(size_t workerIndex) {
+        size_t seenGeneration = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeUp.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                if (stopping) return;
+                seenGeneration = generation;
+            }
+            task(workerIndex);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--pending == 0) finished.notify_one();
+            }
+        }
+    }
+
+public:
+    explicit ThreadPool(size_t threadCount = std::thread::hardware_concurrency()) {
+        if (threadCount == 0) threadCount = 1;
+        for (size_t i = 1; i < threadCount; i++) workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (auto& worker : workers) worker.join();
+    }
+
+    size_t getThreadCount() const { return workers.size() + 1; }
+
+    // Runs job(workerIndex) once on every thread and returns when all of them are done; not reentrant
+    void run(const std::function<void(size_t)>& job) {
+        if (workers.empty()) {
+            job(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            task = job;
+            pending = workers.size();
+            generation++;
+        }
+        wakeUp.notify_all();
+        job(0);
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&] { return pending == 0; });
+    }
+
+    // Hands out [begin, end) in chunks of grainSize; body(chunkBegin, chunkEnd, workerIndex)
+    template<typename F>
+    void parallelFor(size_t begin, size_t end, F&& body, size_t grainSize = 0) {
+        if (begin >= end) return;
+        const size_t threadCount = getThreadCount();
+        if (grainSize == 0) grainSize = std::max<size_t>(1, (end - begin) / (threadCount * 8));
+        if (threadCount == 1 || end - begin <= grainSize) {
+            body(begin, end, 0);
+            return;
+        }
+        std::atomic<size_t> next{begin};
+        run([&](size_t workerIndex) {
+            while (true) {
+                size_t chunkBegin = next.fetch_add(grainSize, std::memory_order_relaxed);
+                if (chunkBegin >= end) break;
+                body(chunkBegin, std::min(end, chunkBegin + grainSize), workerIndex);
+            }
+        });
+    }
+};
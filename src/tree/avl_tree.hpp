@@ -1,3 +1,4 @@
+#pragma once
 #include "binary_search_tree.hpp"
 
 template<typename T>
@@ -7,9 +8,14 @@ public:
     using BinaryTree<T>::root;
 
 protected:
+    // Every node caches the height of its subtree, so balance checks are O(1) and an update only touches one root path
+    static int height(Node* node) { return node == nullptr ? 0 : node->height; }
+
+    static void updateHeight(Node* node) { node->height = std::max(height(node->left), height(node->right)) + 1; }
+
     int getBalanceFactor (Node* node) const {
         if (node == nullptr) return 0;
-        return getHeight(node->left) - getHeight(node->right);
+        return height(node->left) - height(node->right);
     }
 
     void rotateLeft(Node* node) {
@@ -23,6 +29,8 @@ protected:
         if (newRoot->parent == nullptr) root = newRoot;
         else if (newRoot->parent->left == node) newRoot->parent->left = newRoot;
         else newRoot->parent->right = newRoot;
+        updateHeight(node);
+        updateHeight(newRoot);
     }
 
     void rotateRight(Node* node) {
@@ -36,10 +44,13 @@ protected:
         if (newRoot->parent == nullptr) root = newRoot;
         else if (newRoot->parent->left == node) newRoot->parent->left = newRoot;
         else newRoot->parent->right = newRoot;
+        updateHeight(node);
+        updateHeight(newRoot);
     }
 
     void rebalance(Node* node) {
         while (node != nullptr) {
+            updateHeight(node);
             int balance = getBalanceFactor(node);
             if (balance > 1 && getBalanceFactor(node->left) >= 0) rotateRight(node);
             else if (balance > 1 && getBalanceFactor(node->left) < 0) {
@@ -58,30 +69,33 @@ protected:
 public:
     AVLTree() : BinarySearchTree<T>() {}
     
+    // Hides the recursive BinaryTree::getHeight: the cached value is the same, in O(1)
+    int getHeight(Node* node) const { return height(node); }
+
     std::expected<void, DataStructureError> insert(const T& value) {
         if (root == nullptr) {
-            root = new Node(value, nullptr, nullptr, nullptr);
+            root = new Node{value, nullptr, nullptr, nullptr};
             return {};
         }
         Node* current = root;
         while (current != nullptr) {
             if (value < current->data) {
                 if (current->left == nullptr) {
-                    current->left = new Node(value, nullptr, nullptr, current);
+                    current->left = new Node{value, current, nullptr, nullptr};
                     break;
                 }
                 current = current->left;
             } 
             else if (value > current->data) {
                 if (current->right == nullptr) {
-                    current->right = new Node(value, nullptr, nullptr, current);
+                    current->right = new Node{value, current, nullptr, nullptr};
                     break;
                 }
                 current = current->right;
             } 
             else return std::unexpected(DataStructureError::DuplicateValue);
         }
-        rebalance(current->parent);
+        rebalance(current);
         return {};
     }
 
@@ -1,3 +1,4 @@
+#pragma once
 #include "binary_tree.hpp"
 
 template<typename T>
@@ -1,3 +1,4 @@
+#pragma once
 #include <algorithm>
 #include <stack>
 #include <queue>
@@ -12,6 +13,7 @@ public:
         Node* parent;
         Node* left;
         Node* right;
+        int height = 1;   // kept current by AVLTree only; other trees leave it alone
     };
 
 protected:
@@ -0,0 +1,13 @@
+#pragma once
+#include <iostream>
+
+// Minimal assertions for the test executables: a failed CHECK prints where it failed and the test's main returns 1
+inline int failures = 0;
+
+#define CHECK(...) \
+    do { \
+        if (!(__VA_ARGS__)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #__VA_ARGS__ ") failed" << std::endl; \
+            failures++; \
+        } \
+    } while (0)
@@ -0,0 +1,31 @@
+#pragma once
+#include <functional>
+#include <random>
+#include <type_traits>
+#include "graph/adjacency_matrix_graph.hpp"
+
+// Weight drawer for randomGraph: uniform over [min, max], integer or real to match E
+template<typename E>
+std::function<E(std::mt19937_64&)> uniformWeight(E min, E max) {
+    return [min, max](std::mt19937_64& gen) {
+        if constexpr (std::is_floating_point_v<E>) return std::uniform_real_distribution<E>(min, max)(gen);
+        else return std::uniform_int_distribution<E>(min, max)(gen);
+    };
+}
+
+// G(n, p) test graph: vertex i is label(i) (i itself without a label) and every chosen pair gets weight(gen). Undirected
+// graphs and acyclic ones only draw pairs i < j, the latter as edges i -> j
+template<typename V, typename E>
+AdjacencyMatrixGraph<V, E> randomGraph(size_t vertexCount, double probability, typename AdjacencyMatrixGraph<V, E>::GraphType type, std::mt19937_64& gen,
+                                       const std::function<E(std::mt19937_64&)>& weight, const std::function<V(size_t)>& label = nullptr, bool acyclic = false) {
+    using Graph = AdjacencyMatrixGraph<V, E>;
+    Graph graph(type);
+    for (size_t i = 0; i < vertexCount; i++) graph.addVertex(label ? label(i) : static_cast<V>(i));
+    std::bernoulli_distribution coin(probability);
+    for (size_t i = 0; i < vertexCount; i++) {
+        for (size_t j = type == Graph::GraphType::Undirected || acyclic ? i + 1 : 0; j < vertexCount; j++) {
+            if (i != j && coin(gen)) graph.addEdgeByIndex(i, j, weight(gen));
+        }
+    }
+    return graph;
+}
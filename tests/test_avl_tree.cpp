@@ -0,0 +1,78 @@
+#include <cmath>
+#include <random>
+#include <set>
+#include <vector>
+#include "tree/avl_tree.hpp"
+#include "check.hpp"
+
+using Tree = AVLTree<int>;
+using Node = Tree::Node;
+
+// Walks the subtree in order, appending its values, and reports the first broken invariant: keys outside (low, high),
+// a child whose parent pointer does not point back, a cached height that disagrees with the recursive
+// BinaryTree::getHeight, or a balance factor outside [-1, 1]
+bool checkSubtree(const Tree& tree, Node* node, const int* low, const int* high, std::vector<int>& values) {
+    if (node == nullptr) return true;
+    if ((low && node->data <= *low) || (high && node->data >= *high)) return false;
+    if ((node->left && node->left->parent != node) || (node->right && node->right->parent != node)) return false;
+    if (node->height != tree.BinaryTree<int>::getHeight(node)) return false;
+    const int balance = tree.getHeight(node->left) - tree.getHeight(node->right);
+    if (balance < -1 || balance > 1) return false;
+    if (!checkSubtree(tree, node->left, low, &node->data, values)) return false;
+    values.push_back(node->data);
+    return checkSubtree(tree, node->right, &node->data, high, values);
+}
+
+bool isValidAVL(const Tree& tree, const std::set<int>& expected) {
+    if (tree.root != nullptr && tree.root->parent != nullptr) return false;
+    std::vector<int> values;
+    if (!checkSubtree(tree, tree.root, nullptr, nullptr, values)) return false;
+    return values == std::vector<int>(expected.begin(), expected.end());
+}
+
+int main() {
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 6; round++) {
+        Tree tree;
+        std::set<int> expected;
+        const int keyRange = 50 + static_cast<int>(gen() % 400);
+        bool valid = true;
+        for (size_t step = 0; step < 3000; step++) {
+            const int key = static_cast<int>(gen() % static_cast<uint64_t>(keyRange));
+            // Insert-heavy first half, remove-heavy second half, so the tree both grows and drains
+            const bool insert = gen() % 100 < (step < 1500 ? 70u : 30u);
+            if (insert) {
+                auto result = tree.insert(key);
+                if (expected.insert(key).second) CHECK(result.has_value());
+                else CHECK(result.error() == DataStructureError::DuplicateValue);
+            }
+            else {
+                auto result = tree.remove(key);
+                if (expected.erase(key) == 1) CHECK(result.has_value());
+                else CHECK(!result.has_value());
+            }
+            valid &= isValidAVL(tree, expected);
+        }
+        CHECK(valid);
+    }
+
+    // Sorted insertions are the degenerate case for a plain BST; the AVL height bound is 1.44 log2(n + 2)
+    Tree sorted;
+    std::set<int> sortedKeys;
+    for (int key = 0; key < 4096; key++) {
+        sorted.insert(key);
+        sortedKeys.insert(key);
+    }
+    CHECK(isValidAVL(sorted, sortedKeys));
+    CHECK(sorted.getHeight(sorted.root) <= static_cast<int>(1.44 * std::log2(4096.0 + 2)));
+    for (int key = 0; key < 4096; key += 2) {
+        sorted.remove(key);
+        sortedKeys.erase(key);
+    }
+    CHECK(isValidAVL(sorted, sortedKeys));
+
+    Tree empty;
+    CHECK(empty.remove(1).error() == DataStructureError::ContainerIsEmpty);
+    CHECK(empty.getHeight(empty.root) == 0);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "set/concurrent_union_find_set.hpp"
+#include "set/union_find_set.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Pairs = std::vector<std::pair<size_t, size_t>>;
+
+// Set id per element numbered by each set's smallest element, the same convention as ConcurrentUnionFindSet::labels
+std::vector<size_t> sequentialLabels(size_t elementCount, const Pairs& pairs) {
+    DenseUnionFindSet components(elementCount);
+    for (const auto& [a, b] : pairs) components.unite(a, b);
+    std::vector<size_t> rootLabel(elementCount, elementCount);
+    std::vector<size_t> labels(elementCount);
+    size_t next = 0;
+    for (size_t i = 0; i < elementCount; i++) {
+        const size_t root = components.find(i);
+        if (rootLabel[root] == elementCount) rootLabel[root] = next++;
+        labels[i] = rootLabel[root];
+    }
+    return labels;
+}
+
+size_t countSets(const std::vector<size_t>& labels) {
+    size_t count = 0;
+    for (size_t label : labels) count = std::max(count, label + 1);
+    return count;
+}
+
+int main() {
+    ThreadPool pool(4);
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 12; round++) {
+        const size_t elementCount = 1 + gen() % 20000;
+        Pairs pairs(gen() % (2 * elementCount));
+        for (auto& [a, b] : pairs) a = gen() % elementCount, b = gen() % elementCount;
+        const std::vector<size_t> expected = sequentialLabels(elementCount, pairs);
+        const size_t expectedSets = countSets(expected);
+
+        // unite and find racing each other on every worker; finds must always land on an element of the same final set
+        ConcurrentUnionFindSet components(elementCount);
+        std::vector<size_t> probes(pairs.size());
+        for (auto& probe : probes) probe = gen() % elementCount;
+        std::vector<size_t> probeRoots(pairs.size());
+        std::atomic<size_t> merges{0};
+        pool.parallelFor(0, pairs.size(), [&](size_t begin, size_t end, size_t) {
+            for (size_t k = begin; k < end; k++) {
+                merges.fetch_add(components.unite(pairs[k].first, pairs[k].second), std::memory_order_relaxed);
+                probeRoots[k] = components.find(probes[k]);
+            }
+        });
+        CHECK(merges.load() == elementCount - expectedSets);
+        CHECK(components.getSetCount() == expectedSets);
+        CHECK(components.labels(pool) == expected);
+        bool sameSet = true;
+        for (size_t k = 0; k < probes.size(); k++) sameSet &= probeRoots[k] < elementCount && expected[probeRoots[k]] == expected[probes[k]];
+        CHECK(sameSet);
+
+        // The batch overloads against the same oracle
+        ConcurrentUnionFindSet batched(elementCount);
+        CHECK(batched.unite(pairs, pool) == elementCount - expectedSets);
+        std::vector<size_t> elements(elementCount);
+        std::iota(elements.begin(), elements.end(), 0);
+        std::vector<size_t> roots(elementCount);
+        batched.find(elements, roots, pool);
+        // Elements share a root exactly when they share a label
+        std::vector<size_t> rootOfSet(expectedSets, elementCount);
+        bool consistent = true;
+        for (size_t i = 0; i < elementCount; i++) {
+            if (rootOfSet[expected[i]] == elementCount) rootOfSet[expected[i]] = roots[i];
+            consistent &= roots[i] == rootOfSet[expected[i]];
+        }
+        std::sort(rootOfSet.begin(), rootOfSet.end());
+        consistent &= std::adjacent_find(rootOfSet.begin(), rootOfSet.end()) == rootOfSet.end();
+        CHECK(consistent);
+        for (size_t k = 0; k < std::min<size_t>(pairs.size(), 200); k++) {
+            const size_t a = gen() % elementCount;
+            const size_t b = gen() % elementCount;
+            CHECK(batched.isConnected(a, b) == (expected[a] == expected[b]));
+        }
+    }
+
+    // Parallel connectedComponents is the same labelling over the graph's edges, weakly for directed graphs
+    using Graph = AdjacencyMatrixGraph<size_t, int>;
+    for (size_t round = 0; round < 10; round++) {
+        const size_t vertexCount = 1 + gen() % 300;
+        const auto type = round % 2 == 0 ? Graph::GraphType::Directed : Graph::GraphType::Undirected;
+        const Graph graph = randomGraph<size_t, int>(vertexCount, 1.2 / static_cast<double>(vertexCount), type, gen, uniformWeight(1, 1));
+        Pairs edges;
+        for (size_t u = 0; u < vertexCount; u++) {
+            for (size_t v = 0; v < vertexCount; v++) if (graph.hasEdgeByIndex(u, v)) edges.push_back({u, v});
+        }
+        CHECK(graph.connectedComponents(pool) == sequentialLabels(vertexCount, edges));
+    }
+    return failures == 0 ? 0 : 1;
+}
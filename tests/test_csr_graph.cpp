@@ -0,0 +1,68 @@
+#include <random>
+#include <vector>
+#include "graph/csr_graph.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Matrix = AdjacencyMatrixGraph<int, int>;
+using CSR = CSRGraph<int, int>;
+
+// Each undirected edge is stored in both rows, which doubles both totals alike
+int totalWeight(const CSR& graph) {
+    int total = 0;
+    const std::vector<int> vertices = graph.getVertices([](int) {}).value();
+    for (int vertex : vertices) {
+        const std::vector<int> neighbours = graph.getNeighbours(vertex, [](int) {}).value();
+        for (int neighbour : neighbours) total += graph.getEdge(vertex, neighbour).value();
+    }
+    return total;
+}
+
+int main() {
+    // Traversals and Dijkstra against the matrix graph, which walks neighbours in the same ascending index order
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 20; round++) {
+        const size_t vertexCount = 1 + gen() % 80;
+        const auto type = round % 2 == 0 ? Matrix::GraphType::Directed : Matrix::GraphType::Undirected;
+        const Matrix matrix = randomGraph<int, int>(vertexCount, 3.0 / static_cast<double>(vertexCount), type, gen, uniformWeight(0, 99), [](size_t i) { return static_cast<int>(i) * 3; });
+        const CSR csr(matrix);
+        CHECK(csr.getEdgeCount() == matrix.getEdgeCount());
+        CHECK(csr.DFSRecursive(0, [](int) {}) == matrix.DFSRecursive(0, [](int) {}));
+        CHECK(csr.DFSIterative(0, [](int) {}) == matrix.DFSIterative(0, [](int) {}));
+        CHECK(csr.BFS(0, [](int) {}) == matrix.BFS(0, [](int) {}));
+        if (type == Matrix::GraphType::Directed) CHECK(csr.Dijkstra(0) == matrix.Dijkstra(0));
+        else if (csr.isConnected().value()) CHECK(totalWeight(csr.primMST(0).value()) == totalWeight(csr.kruskalMST().value()));
+    }
+
+    // A chain far deeper than the call stack would allow a recursive DFS
+    const size_t depth = 1000000;
+    std::vector<int> chainVertices(depth);
+    std::vector<CSR::Edge> chainEdges;
+    for (size_t i = 0; i < depth; i++) {
+        chainVertices[i] = static_cast<int>(i);
+        if (i > 0) chainEdges.push_back({i - 1, i, 1});
+    }
+    const CSR chain(chainVertices, chainEdges);
+    const std::vector<int> order = chain.DFSRecursive(0, [](int) {}).value();
+    CHECK(order.size() == depth && order.back() == static_cast<int>(depth) - 1);
+
+    // The matrix walk keeps its frames on the heap too; a bool matrix keeps a long chain down to one bit per cell
+    const size_t matrixDepth = 20000;
+    AdjacencyMatrixGraph<int, bool> matrixChain(AdjacencyMatrixGraph<int, bool>::GraphType::Directed);
+    for (size_t i = 0; i < matrixDepth; i++) matrixChain.addVertex(static_cast<int>(i));
+    for (size_t i = 1; i < matrixDepth; i++) matrixChain.addEdgeByIndex(i - 1, i, true);
+    const std::vector<int> matrixOrder = matrixChain.DFSRecursive(0, [](int) {}).value();
+    CHECK(matrixOrder.size() == matrixDepth && matrixOrder.back() == static_cast<int>(matrixDepth) - 1);
+
+    // Out-of-range edges are skipped and repeated vertices collapse onto their first copy
+    const CSR outOfRange({1, 2}, {{0, 5, 1}, {0, 1, 4}});
+    CHECK(outOfRange.getEdgeCount() == size_t{1});
+    CHECK(outOfRange.getEdge(1, 2) == 4);
+    const CSR repeated({1, 1, 2}, {{1, 2, 5}, {0, 2, 6}}, CSR::GraphType::Undirected);
+    CHECK(repeated.getVertexCount() == size_t{2});
+    CHECK(repeated.getEdge(2, 1) == 5);
+    CHECK(repeated.getDegree(1) == size_t{1});
+    CHECK(repeated.isConnected() == true);
+    CHECK(CSR({1, 2, 3}, {{0, 1, 1}}, CSR::GraphType::Undirected).isConnected() == false);
+    return failures == 0 ? 0 : 1;
+}
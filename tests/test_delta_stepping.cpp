@@ -0,0 +1,53 @@
+#include <random>
+#include <vector>
+#include "graph/adjacency_matrix_graph.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+template<typename E>
+using Graph = AdjacencyMatrixGraph<size_t, E>;
+
+template<typename E>
+void compareWithDijkstra(const Graph<E>& graph, ThreadPool& pool, E delta) {
+    auto expected = graph.DijkstraByIndex(0);
+    auto actual = graph.deltaSteppingByIndex(0, pool, delta);
+    CHECK(expected.has_value() && actual.has_value());
+    if (expected && actual) CHECK(*expected == *actual);
+}
+
+template<typename E>
+void randomGraphs(ThreadPool& pool, E maxWeight, std::vector<E> deltas, uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    for (size_t round = 0; round < 20; round++) {
+        const size_t vertexCount = 2 + gen() % 120;
+        const auto type = round % 2 == 0 ? Graph<E>::GraphType::Directed : Graph<E>::GraphType::Undirected;
+        const Graph<E> graph = randomGraph<size_t, E>(vertexCount, 4.0 / static_cast<double>(vertexCount), type, gen, uniformWeight<E>(0, maxWeight));
+        for (E delta : deltas) compareWithDijkstra(graph, pool, delta);
+    }
+}
+
+int main() {
+    ThreadPool pool(4);
+
+    // One huge weight with a tiny delta used to allocate a bucket for every multiple of delta up to the distance
+    Graph<long long> spread(Graph<long long>::GraphType::Directed);
+    for (size_t i = 0; i < 3; i++) spread.addVertex(i);
+    spread.addEdgeByIndex(0, 1, 1);
+    spread.addEdgeByIndex(1, 2, 4000000000LL);
+    compareWithDijkstra(spread, pool, 1LL);
+
+    randomGraphs<int>(pool, 100, {0, 1, 7, 1000}, 1);
+    randomGraphs<long long>(pool, 4000000000LL, {0, 1, 3}, 2);
+    randomGraphs<unsigned>(pool, 10000000u, {0u, 1u, 64u}, 3);
+    randomGraphs<double>(pool, 1e9, {0.0, 0.5, 1e6}, 4);
+
+    std::mt19937_64 gen(5);
+    const Graph<int> negativeDelta = randomGraph<size_t, int>(10, 0.3, Graph<int>::GraphType::Directed, gen, uniformWeight(0, 10));
+    CHECK(negativeDelta.deltaSteppingByIndex(0, pool, -1).error() == DataStructureError::InvalidArgument);
+    CHECK(negativeDelta.deltaSteppingByIndex(10, pool, 1).error() == DataStructureError::IndexOutOfRange);
+    Graph<int> negativeEdge = randomGraph<size_t, int>(10, 0.3, Graph<int>::GraphType::Directed, gen, uniformWeight(0, 10));
+    negativeEdge.removeEdgeByIndex(0, 1);
+    negativeEdge.addEdgeByIndex(0, 1, -3);
+    for (int delta : {0, 1, 5}) CHECK(negativeEdge.deltaSteppingByIndex(0, pool, delta).error() == DataStructureError::InvalidArgument);
+    return failures == 0 ? 0 : 1;
+}
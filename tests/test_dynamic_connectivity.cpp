@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "graph/dynamic_connectivity.hpp"
+#include "check.hpp"
+
+using Event = ConnectivityEvent<size_t>;
+using Type = ConnectivityEventType;
+
+// Answers every query with a BFS over the edges alive at that moment, sharing no code with the union-find under test
+std::vector<bool> replay(size_t vertexCount, const std::vector<std::pair<size_t, size_t>>& initial, const std::vector<Event>& events) {
+    std::vector<std::pair<size_t, size_t>> alive = initial;
+    std::vector<bool> answers;
+    for (const auto& event : events) {
+        const std::pair<size_t, size_t> edge = std::minmax(event.first, event.second);
+        if (event.type == Type::AddEdge) alive.push_back(edge);
+        else if (event.type == Type::RemoveEdge) alive.erase(std::find(alive.begin(), alive.end(), edge));
+        else {
+            std::vector<std::vector<size_t>> neighbours(vertexCount);
+            for (const auto& [u, v] : alive) {
+                neighbours[u].push_back(v);
+                neighbours[v].push_back(u);
+            }
+            std::vector<bool> seen(vertexCount, false);
+            std::vector<size_t> queue{event.first};
+            seen[event.first] = true;
+            for (size_t head = 0; head < queue.size(); head++) {
+                for (size_t next : neighbours[queue[head]]) {
+                    if (seen[next]) continue;
+                    seen[next] = true;
+                    queue.push_back(next);
+                }
+            }
+            answers.push_back(seen[event.second]);
+        }
+    }
+    return answers;
+}
+
+// Random timeline; removals always pick one of the copies currently alive, so repeated edges are exercised too
+std::vector<Event> randomEvents(size_t vertexCount, size_t eventCount, std::vector<std::pair<size_t, size_t>> alive, std::mt19937_64& gen) {
+    std::vector<Event> events;
+    for (size_t k = 0; k < eventCount; k++) {
+        const size_t roll = gen() % 10;
+        if (roll < 4) {
+            const size_t u = gen() % vertexCount;
+            const size_t v = gen() % vertexCount;
+            events.push_back({Type::AddEdge, u, v});
+            alive.push_back(std::minmax(u, v));
+        }
+        else if (roll < 6 && !alive.empty()) {
+            const size_t pick = gen() % alive.size();
+            events.push_back({Type::RemoveEdge, alive[pick].second, alive[pick].first});
+            alive.erase(alive.begin() + static_cast<std::ptrdiff_t>(pick));
+        }
+        else events.push_back({Type::Query, gen() % vertexCount, gen() % vertexCount});
+    }
+    return events;
+}
+
+int main() {
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 30; round++) {
+        const size_t vertexCount = 1 + gen() % 40;
+        const std::vector<Event> events = randomEvents(vertexCount, 1 + gen() % 400, {}, gen);
+        CHECK(offlineConnectivityByIndex(vertexCount, events) == replay(vertexCount, {}, events));
+    }
+
+    // The graph overload starts from the graph's own edges and takes vertex values
+    using Graph = AdjacencyMatrixGraph<int, int>;
+    for (size_t round = 0; round < 10; round++) {
+        const size_t vertexCount = 2 + gen() % 30;
+        Graph graph(Graph::GraphType::Undirected);
+        for (size_t i = 0; i < vertexCount; i++) graph.addVertex(static_cast<int>(i) * 3);
+        std::vector<std::pair<size_t, size_t>> initial;
+        for (size_t k = 0; k < vertexCount / 2; k++) {
+            const size_t u = gen() % vertexCount;
+            const size_t v = gen() % vertexCount;
+            if (u == v || graph.hasEdgeByIndex(u, v)) continue;
+            graph.addEdgeByIndex(u, v, 1);
+            initial.push_back(std::minmax(u, v));
+        }
+        const std::vector<Event> events = randomEvents(vertexCount, 200, initial, gen);
+        std::vector<ConnectivityEvent<int>> valued;
+        for (const auto& event : events) valued.push_back({event.type, static_cast<int>(event.first) * 3, static_cast<int>(event.second) * 3});
+        CHECK(offlineConnectivity(graph, valued) == replay(vertexCount, initial, events));
+    }
+
+    CHECK(offlineConnectivityByIndex(3, std::vector<Event>{{Type::RemoveEdge, 0, 1}}).error() == DataStructureError::ElementNotFound);
+    CHECK(offlineConnectivityByIndex(3, std::vector<Event>{{Type::Query, 0, 3}}).error() == DataStructureError::IndexOutOfRange);
+    Graph directed(Graph::GraphType::Directed);
+    directed.addVertex(0);
+    CHECK(offlineConnectivity(directed, std::vector<ConnectivityEvent<int>>{}).error() == DataStructureError::InvalidOperation);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+#include <random>
+#include <string>
+#include <vector>
+#include "graph/edge_list.hpp"
+#include "check.hpp"
+
+using Graph = AdjacencyMatrixGraph<int, int>;
+
+int main() {
+    ThreadPool pool(4);
+
+    // Parsed text against the same edges added one by one
+    std::mt19937_64 gen(1);
+    std::string text = "# comment\n% comment\n\n";
+    Graph expected(Graph::GraphType::Directed);
+    for (size_t k = 0; k < 3000; k++) {
+        const int u = static_cast<int>(gen() % 400) * 7;
+        const int v = static_cast<int>(gen() % 400) * 7;
+        const int weight = static_cast<int>(gen() % 100);
+        text += std::to_string(u) + " " + std::to_string(v) + (k % 5 == 0 ? "" : " " + std::to_string(weight)) + "\n";
+        expected.addVertex(u);
+        expected.addVertex(v);
+        if (!expected.hasEdge(u, v)) expected.addEdge(u, v, k % 5 == 0 ? 1 : weight);
+    }
+    auto list = parseEdgeList<int, int>(text, pool);
+    CHECK(list.has_value());
+    const Graph parsed(list->vertices, list->edges, Graph::GraphType::Directed);
+    CHECK(parsed.getVertexCount() == expected.getVertexCount());
+    CHECK(parsed.getEdgeCount() == expected.getEdgeCount());
+    for (int vertex : list->vertices) {
+        CHECK(parsed.getVertexIndex(vertex).has_value());
+        const std::vector<int> neighbours = expected.getNeighbours(vertex, [](int) {}).value();
+        for (int neighbour : neighbours) CHECK(parsed.getEdge(vertex, neighbour) == expected.getEdge(vertex, neighbour));
+    }
+    CHECK(parseEdgeList<int, int>("1 2 3\n1 x\n", pool).error() == DataStructureError::InvalidFileFormat);
+
+    // A repeated vertex collapses onto its first copy and out-of-range edges are skipped
+    Graph repeated({1, 1, 2}, {{1, 2, 5}, {0, 7, 9}}, Graph::GraphType::Undirected);
+    CHECK(repeated.getVertexCount() == size_t{2});
+    CHECK(repeated.getEdgeCount() == size_t{2});
+    CHECK(repeated.getEdge(1, 2) == 5);
+    CHECK(repeated.removeVertex(1).has_value());
+    CHECK(!repeated.hasVertex(1));
+    CHECK(repeated.getVertexIndex(2) == size_t{0});
+    return failures == 0 ? 0 : 1;
+}
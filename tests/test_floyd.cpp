@@ -0,0 +1,59 @@
+#include <random>
+#include <vector>
+#include "graph/adjacency_matrix_graph.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+template<typename E>
+using Graph = AdjacencyMatrixGraph<size_t, E>;
+
+template<typename E>
+void compareWithFloyd(const Graph<E>& graph, ThreadPool& pool) {
+    auto expected = graph.floyd();
+    auto actual = graph.floydBlocked(pool);
+    CHECK(expected.has_value() && actual.has_value());
+    if (!expected || !actual) return;
+    const size_t vertexCount = expected->size();
+    bool same = actual->size() == vertexCount * vertexCount;
+    for (size_t i = 0; same && i < vertexCount; i++) {
+        for (size_t j = 0; j < vertexCount; j++) same &= (*expected)[i][j] == (*actual)[i * vertexCount + j];
+    }
+    CHECK(same);
+}
+
+// Edges only go from lower to higher index when minWeight is negative, so there is never a negative cycle
+template<typename E>
+void randomGraphs(ThreadPool& pool, E minWeight, E maxWeight, typename Graph<E>::GraphType type, uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    for (size_t round = 0; round < 6; round++) {
+        const size_t vertexCount = 1 + gen() % 150;
+        // Multiples of 1/8 add up exactly, so both versions must agree to the bit whatever order they sum in
+        std::function<E(std::mt19937_64&)> weight = uniformWeight(minWeight, maxWeight);
+        if constexpr (std::is_floating_point_v<E>) {
+            weight = [minWeight, maxWeight](std::mt19937_64& gen) { return std::uniform_int_distribution<int>(minWeight * 8, maxWeight * 8)(gen) / E{8}; };
+        }
+        const Graph<E> graph = randomGraph<size_t, E>(vertexCount, 6.0 / static_cast<double>(vertexCount), type, gen, weight, nullptr, minWeight < 0);
+        compareWithFloyd(graph, pool);
+    }
+}
+
+int main() {
+    ThreadPool pool(4);
+
+    // Distances of a quarter of max or more used to come back as unreachable
+    Graph<int> far(Graph<int>::GraphType::Directed);
+    far.addVertex(0);
+    far.addVertex(1);
+    far.addEdgeByIndex(0, 1, 600000000);
+    compareWithFloyd(far, pool);
+    CHECK(far.floydBlocked(pool).value()[1] == 600000000);
+    CHECK(far.floydBlocked(pool).value()[2] == std::numeric_limits<int>::max());
+
+    randomGraphs<int>(pool, 1, 100, Graph<int>::GraphType::Directed, 1);
+    randomGraphs<int>(pool, -50, 100, Graph<int>::GraphType::Directed, 2);
+    randomGraphs<int>(pool, 1, 100, Graph<int>::GraphType::Undirected, 3);
+    randomGraphs<long long>(pool, 1, 1000000000000000LL, Graph<long long>::GraphType::Directed, 4);
+    randomGraphs<unsigned>(pool, 1, 10000000u, Graph<unsigned>::GraphType::Directed, 5);
+    randomGraphs<double>(pool, 0.0, 100.0, Graph<double>::GraphType::Directed, 6);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,125 @@
+#include <cmath>
+#include <random>
+#include <vector>
+#include "graph/graph_linear_algebra.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Graph = AdjacencyMatrixGraph<int, int>;
+
+// y = A x (or A^T x) cell by cell through the public edge queries
+std::vector<long long> naiveProduct(const Graph& graph, const std::vector<long long>& x, bool transposed) {
+    const size_t vertexCount = x.size();
+    std::vector<long long> y(vertexCount, 0);
+    for (size_t i = 0; i < vertexCount; i++) {
+        for (size_t j = 0; j < vertexCount; j++) {
+            auto weight = transposed ? graph.getEdgeByIndex(j, i) : graph.getEdgeByIndex(i, j);
+            if (weight) y[i] += static_cast<long long>(*weight) * x[j];
+        }
+    }
+    return y;
+}
+
+// Textbook power iteration for the same update rule, on a dense out-neighbour scan
+std::vector<double> naivePageRank(const Graph& graph, std::vector<double> teleport, double damping, size_t iterations) {
+    const size_t vertexCount = teleport.size();
+    double mass = 0;
+    for (double weight : teleport) mass += weight;
+    for (double& weight : teleport) weight /= mass;
+    std::vector<double> ranks = teleport;
+    for (size_t iteration = 0; iteration < iterations; iteration++) {
+        std::vector<double> next(vertexCount, 0.0);
+        double dangling = 0;
+        for (size_t i = 0; i < vertexCount; i++) {
+            std::vector<size_t> out;
+            for (size_t j = 0; j < vertexCount; j++) if (graph.hasEdgeByIndex(i, j)) out.push_back(j);
+            if (out.empty()) dangling += ranks[i];
+            for (size_t j : out) next[j] += ranks[i] / static_cast<double>(out.size());
+        }
+        for (size_t i = 0; i < vertexCount; i++) next[i] = damping * next[i] + (damping * dangling + 1 - damping) * teleport[i];
+        ranks = next;
+    }
+    return ranks;
+}
+
+double maxDifference(const std::vector<double>& a, const std::vector<double>& b) {
+    double difference = 0;
+    for (size_t i = 0; i < a.size(); i++) difference = std::max(difference, std::abs(a[i] - b[i]));
+    return difference;
+}
+
+double total(const std::vector<double>& values) {
+    double sum = 0;
+    for (double value : values) sum += value;
+    return sum;
+}
+
+int main() {
+    ThreadPool pool(4);
+    std::mt19937_64 gen(1);
+
+    // Dense rows fill whole 64-bit presence words past DenseWordEdges and take the streaming loop; sparse ones walk bits.
+    // 150 vertices also leave a partial last word, which always walks bits
+    for (double probability : {0.02, 0.6}) {
+        for (auto type : {Graph::GraphType::Directed, Graph::GraphType::Undirected}) {
+            const Graph graph = randomGraph<int, int>(150, probability, type, gen, uniformWeight(-20, 20));
+            std::vector<long long> x(150);
+            for (long long& value : x) value = static_cast<long long>(gen() % 201) - 100;
+            CHECK(multiplyAdjacency(graph, x, pool).value() == naiveProduct(graph, x, false));
+            CHECK(multiplyAdjacencyTransposed(graph, x, pool).value() == naiveProduct(graph, x, true));
+        }
+    }
+    const Graph small = randomGraph<int, int>(5, 0.5, Graph::GraphType::Directed, gen, uniformWeight(1, 9));
+    CHECK(multiplyAdjacency(small, std::vector<long long>(4, 1), pool).error() == DataStructureError::InvalidArgument);
+    CHECK(multiplyAdjacencyTransposed(small, std::vector<long long>(6, 1), pool).error() == DataStructureError::InvalidArgument);
+
+    for (size_t round = 0; round < 12; round++) {
+        const size_t vertexCount = 1 + gen() % 120;
+        const auto type = round % 2 == 0 ? Graph::GraphType::Directed : Graph::GraphType::Undirected;
+        // Sparse enough that some vertices are dangling
+        const Graph graph = randomGraph<int, int>(vertexCount, 1.5 / static_cast<double>(vertexCount), type, gen, uniformWeight(1, 9));
+        std::vector<double> teleport(vertexCount);
+        for (double& weight : teleport) weight = static_cast<double>(gen() % 4);
+        teleport[gen() % vertexCount] = 1;
+
+        // With tolerance 0 only an exact fixed point stops it before maxIterations
+        const size_t steps = 1 + gen() % 40;
+        const PageRankResult fixed = personalizedPageRankByIndex(graph, teleport, pool, 0.85, 0.0, steps).value();
+        CHECK(fixed.iterations == steps || (fixed.iterations < steps && fixed.residual == 0));
+        CHECK(maxDifference(fixed.ranks, naivePageRank(graph, teleport, 0.85, steps)) < 1e-12);
+        CHECK(std::abs(total(fixed.ranks) - 1) < 1e-9);
+
+        const PageRankResult converged = personalizedPageRankByIndex(graph, teleport, pool, 0.85, 1e-8, 1000).value();
+        CHECK(converged.residual <= 1e-8 && converged.iterations < 1000);
+        CHECK(std::abs(total(converged.ranks) - 1) < 1e-9);
+        CHECK(maxDifference(converged.ranks, naivePageRank(graph, teleport, 0.85, converged.iterations)) < 1e-12);
+
+        const PageRankResult uniform = pageRank(graph, pool).value();
+        CHECK(std::abs(total(uniform.ranks) - 1) < 1e-9);
+        CHECK(uniform.iterations <= size_t{100} && (uniform.residual <= 1e-9 || uniform.iterations == size_t{100}));
+    }
+
+    // A directed cycle never settles under damping 1 from a single-vertex start, so maxIterations is what stops it
+    Graph cycle(Graph::GraphType::Directed);
+    for (int vertex = 0; vertex < 3; vertex++) cycle.addVertex(vertex);
+    for (int vertex = 0; vertex < 3; vertex++) cycle.addEdge(vertex, (vertex + 1) % 3, 1);
+    const PageRankResult spinning = personalizedPageRank(cycle, {0}, pool, 1.0, 1e-12, 7).value();
+    CHECK(spinning.iterations == size_t{7} && spinning.residual > 1.0);
+    CHECK(std::abs(spinning.ranks[1] - 1) < 1e-12);
+    // Damping 0 is the teleport distribution after one step
+    const PageRankResult teleportOnly = personalizedPageRank(cycle, {2}, pool, 0.0).value();
+    CHECK(teleportOnly.ranks == std::vector<double>{0, 0, 1});
+
+    const double nan = std::nan("");
+    const double inf = std::numeric_limits<double>::infinity();
+    for (double damping : {-0.1, 1.5, nan}) CHECK(personalizedPageRankByIndex(cycle, {1, 1, 1}, pool, damping).error() == DataStructureError::InvalidArgument);
+    CHECK(personalizedPageRankByIndex(cycle, {1, 1, 1}, pool, 0.85, -1.0).error() == DataStructureError::InvalidArgument);
+    CHECK(personalizedPageRankByIndex(cycle, {1, 1, 1}, pool, 0.85, nan).error() == DataStructureError::InvalidArgument);
+    for (const std::vector<double>& teleport : std::vector<std::vector<double>>{{1, 1}, {1, -1, 1}, {0, 0, 0}, {1, nan, 1}, {1, inf, 1}, {1e308, 1e308, 1e308}}) {
+        CHECK(personalizedPageRankByIndex(cycle, teleport, pool).error() == DataStructureError::InvalidArgument);
+    }
+    CHECK(personalizedPageRank(cycle, {}, pool).error() == DataStructureError::InvalidArgument);
+    CHECK(!personalizedPageRank(cycle, {9}, pool).has_value());
+    CHECK(pageRank(Graph(Graph::GraphType::Directed), pool).error() == DataStructureError::ContainerIsEmpty);
+    return failures == 0 ? 0 : 1;
+}
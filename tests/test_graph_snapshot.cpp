@@ -0,0 +1,92 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "graph/graph_snapshot.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Matrix = AdjacencyMatrixGraph<int, long long>;
+using CSR = CSRGraph<int, long long>;
+using Mapped = MappedGraph<int, long long>;
+
+int main() {
+    const std::string path = (std::filesystem::temp_directory_path() / "test_graph_snapshot.bin").string();
+
+    // Everything read back from the mapping matches the CSR graph it was written from
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 10; round++) {
+        const size_t vertexCount = 1 + gen() % 70;
+        const auto type = round % 2 == 0 ? Matrix::GraphType::Directed : Matrix::GraphType::Undirected;
+        const CSR csr(randomGraph<int, long long>(vertexCount, 3.0 / static_cast<double>(vertexCount), type, gen, uniformWeight(0LL, 999LL), [](size_t i) {
+            // Vertex values out of insertion order, so lookups have to go through the sorted vertex order section
+            return static_cast<int>((i * 7919) % 10007);
+        }));
+        CHECK(writeGraphSnapshot(csr, path).has_value());
+        auto opened = Mapped::open(path);
+        CHECK(opened.has_value());
+        if (!opened) continue;
+        const Mapped mapped = std::move(*opened);
+        CHECK(mapped.verify().has_value());
+        CHECK(mapped.getGraphType() == type);
+        CHECK(mapped.getEdgeCount() == csr.getEdgeCount());
+        const std::vector<int> vertices = csr.getVertices([](int) {}).value();
+        CHECK(std::vector<int>(mapped.getVertexTable().begin(), mapped.getVertexTable().end()) == vertices);
+        for (size_t i = 0; i < vertexCount; i++) {
+            const int vertex = vertices[i];
+            CHECK(mapped.getVertexIndex(vertex) == i);
+            CHECK(mapped.getNeighbours(vertex, [](int) {}) == csr.getNeighbours(vertex, [](int) {}));
+            const std::vector<int> neighbours = csr.getNeighbours(vertex, [](int) {}).value();
+            for (int neighbour : neighbours) CHECK(mapped.getEdge(vertex, neighbour) == csr.getEdge(vertex, neighbour));
+        }
+        const size_t targetIndex = gen() % vertexCount;
+        const int source = vertices[gen() % vertexCount];
+        const int target = vertices[targetIndex];
+        CHECK(mapped.DFSRecursive(source, [](int) {}) == csr.DFSRecursive(source, [](int) {}));
+        CHECK(mapped.DFSIterative(source, [](int) {}) == csr.DFSIterative(source, [](int) {}));
+        CHECK(mapped.BFS(source, [](int) {}) == csr.BFS(source, [](int) {}));
+        CHECK(mapped.hasPath(source, target) == csr.hasPath(source, target));
+        const std::vector<long long> distances = csr.Dijkstra(source).value();
+        CHECK(mapped.Dijkstra(source) == distances);
+        auto path = mapped.shortestPath(source, target);
+        const long long distance = distances[targetIndex];
+        if (distance == std::numeric_limits<long long>::max()) CHECK(path.error() == DataStructureError::ElementNotFound);
+        else CHECK(path.has_value() && path->distance == distance && path->path.front() == source && path->path.back() == target);
+    }
+    CHECK(!Mapped::open(path).value().hasVertex(-1));
+
+    // Damaged files are rejected by open() rather than read out of bounds
+    {
+        std::ofstream truncated(path, std::ios::binary | std::ios::trunc);
+        truncated << "DSGRAPH";
+    }
+    CHECK(Mapped::open(path).error() == DataStructureError::InvalidFileFormat);
+    CHECK(MappedGraph<int, int>::open(path + ".missing").error() == DataStructureError::FileOperationFailed);
+    const CSR small(std::vector<int>{1, 2}, {{0, 1, 5}});
+    CHECK(writeGraphSnapshot(small, path).has_value());
+    CHECK(MappedGraph<int, int>::open(path).error() == DataStructureError::InvalidFileFormat);
+
+    // Rows of 2, 0 and 1 edges: offsets 0 2 2 3, targets 1 2 0. A decreasing offset fails open(); an out-of-range target
+    // opens but fails verify()
+    const CSR rows(std::vector<int>{1, 2, 3}, {{0, 1, 4}, {0, 2, 5}, {2, 0, 6}});
+    auto patch = [&](bool offsets, size_t slot, uint64_t value) {
+        CHECK(writeGraphSnapshot(rows, path).has_value());
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        GraphSnapshotHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        file.seekp(static_cast<std::streamoff>((offsets ? header.offsetsOffset : header.targetsOffset) + slot * sizeof(uint64_t)));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    patch(true, 1, 3);
+    CHECK(Mapped::open(path).error() == DataStructureError::InvalidFileFormat);
+    patch(false, 1, 3);
+    CHECK(Mapped::open(path).value().verify().error() == DataStructureError::InvalidFileFormat);
+    patch(false, 1, 1);
+    CHECK(Mapped::open(path).value().verify().error() == DataStructureError::InvalidFileFormat);
+    patch(false, 1, 2);
+    CHECK(Mapped::open(path).value().verify().has_value());
+    std::remove(path.c_str());
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+#include <random>
+#include <vector>
+#include "graph/adjacency_matrix_graph.hpp"
+#include "check.hpp"
+
+using Graph = AdjacencyMatrixGraph<int, int>;
+
+// Component id per vertex from a fresh BFS over the current edges, independent of the maintained union-find
+std::vector<size_t> bfsComponents(const Graph& graph, size_t& componentCount) {
+    const size_t vertexCount = graph.getGraph().vertices.size();
+    std::vector<size_t> component(vertexCount, vertexCount);
+    componentCount = 0;
+    for (size_t root = 0; root < vertexCount; root++) {
+        if (component[root] != vertexCount) continue;
+        std::vector<size_t> queue{root};
+        component[root] = componentCount;
+        for (size_t head = 0; head < queue.size(); head++) {
+            for (size_t next = 0; next < vertexCount; next++) {
+                if (component[next] != vertexCount || !graph.hasEdgeByIndex(queue[head], next)) continue;
+                component[next] = componentCount;
+                queue.push_back(next);
+            }
+        }
+        componentCount++;
+    }
+    return component;
+}
+
+void checkAgainstBFS(const Graph& graph) {
+    size_t componentCount = 0;
+    const std::vector<size_t> component = bfsComponents(graph, componentCount);
+    const size_t vertexCount = component.size();
+    if (vertexCount == 0) return;
+    CHECK(graph.getComponentCount() == componentCount);
+    CHECK(graph.isConnected() == (componentCount == 1));
+    std::vector<size_t> size(componentCount, 0);
+    for (size_t c : component) size[c]++;
+    bool same = true;
+    for (size_t u = 0; u < vertexCount; u++) {
+        same &= graph.getComponentSizeByIndex(u) == size[component[u]];
+        for (size_t v = 0; v < vertexCount; v++) same &= graph.hasPathByIndex(u, v) == (component[u] == component[v]);
+    }
+    CHECK(same);
+}
+
+int main() {
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 8; round++) {
+        Graph graph(Graph::GraphType::Undirected);
+        int nextValue = 0;
+        for (size_t i = 0; i < 25; i++) graph.addVertex(nextValue++);
+        CHECK(graph.enableIncrementalConnectivity().has_value());
+        // Sparse edges keep most of them bridges, so removals split components often
+        for (size_t step = 0; step < 400; step++) {
+            const size_t vertexCount = graph.getGraph().vertices.size();
+            const size_t roll = gen() % 100;
+            if (roll < 40 && vertexCount > 0) {
+                const size_t u = gen() % vertexCount;
+                const size_t v = gen() % 8 == 0 ? u : gen() % vertexCount;
+                if (!graph.hasEdgeByIndex(u, v)) graph.addEdgeByIndex(u, v, 1);
+            }
+            else if (roll < 80) {
+                std::vector<std::pair<size_t, size_t>> edges;
+                for (size_t u = 0; u < vertexCount; u++) {
+                    for (size_t v = u; v < vertexCount; v++) if (graph.hasEdgeByIndex(u, v)) edges.push_back({u, v});
+                }
+                if (!edges.empty()) {
+                    const auto [u, v] = edges[gen() % edges.size()];
+                    CHECK(graph.removeEdgeByIndex(u, v).has_value());
+                }
+            }
+            else if (roll < 92 && vertexCount > 0) CHECK(graph.removeVertex(graph.getVertex(gen() % vertexCount).value()).has_value());
+            else graph.addVertex(nextValue++);
+            checkAgainstBFS(graph);
+        }
+    }
+
+    // Cutting the middle of a path splits one component into two of the right sizes
+    Graph path(Graph::GraphType::Undirected);
+    for (int i = 0; i < 6; i++) path.addVertex(i);
+    for (int i = 0; i + 1 < 6; i++) path.addEdge(i, i + 1, 1);
+    CHECK(path.enableIncrementalConnectivity().has_value());
+    CHECK(path.getComponentCount() == size_t{1});
+    CHECK(path.removeEdge(2, 3).has_value());
+    CHECK(path.getComponentCount() == size_t{2});
+    CHECK(path.getComponentSize(0) == size_t{3} && path.getComponentSize(5) == size_t{3});
+    CHECK(path.hasPath(0, 5) == false);
+    CHECK(path.removeVertex(1).has_value());
+    CHECK(path.getComponentCount() == size_t{3});
+    checkAgainstBFS(path);
+
+    Graph directed(Graph::GraphType::Directed);
+    CHECK(directed.enableIncrementalConnectivity().error() == DataStructureError::InvalidOperation);
+    CHECK(directed.getComponentCount().error() == DataStructureError::InvalidOperation);
+    return failures == 0 ? 0 : 1;
+}
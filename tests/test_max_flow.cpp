@@ -0,0 +1,89 @@
+#include <random>
+#include <vector>
+#include "graph/max_flow.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Graph = AdjacencyMatrixGraph<int, long long>;
+using Result = MaxFlowResult<int, long long>;
+
+// Cheapest cut over every vertex subset that holds the source and not the sink; undirected edges count once
+long long bruteForceMinCut(const Graph& graph, size_t source, size_t sink) {
+    const size_t vertexCount = graph.getVertexCount().value();
+    long long best = std::numeric_limits<long long>::max();
+    for (uint32_t subset = 0; subset < (uint32_t{1} << vertexCount); subset++) {
+        if (!(subset >> source & 1) || (subset >> sink & 1)) continue;
+        long long cut = 0;
+        for (size_t i = 0; i < vertexCount; i++) {
+            for (size_t j = 0; j < vertexCount; j++) {
+                if ((subset >> i & 1) && !(subset >> j & 1) && graph.hasEdgeByIndex(i, j)) cut += graph.getEdgeByIndex(i, j).value();
+            }
+        }
+        best = std::min(best, cut);
+    }
+    return best;
+}
+
+// Flows respect capacities and are conserved everywhere but at the terminals; the reported cut separates them and adds up to the value
+void checkFlow(const Graph& graph, const Result& result, size_t source, size_t sink) {
+    const size_t vertexCount = graph.getVertexCount().value();
+    std::vector<long long> balance(vertexCount, 0);
+    for (const auto& edge : result.flows) {
+        CHECK(graph.hasEdgeByIndex(edge.start, edge.end));
+        CHECK(edge.weight >= 0 && edge.weight <= graph.getEdgeByIndex(edge.start, edge.end).value());
+        balance[edge.start] -= edge.weight;
+        balance[edge.end] += edge.weight;
+    }
+    for (size_t i = 0; i < vertexCount; i++) {
+        if (i == source) CHECK(balance[i] == -result.value);
+        else if (i == sink) CHECK(balance[i] == result.value);
+        else CHECK(balance[i] == 0);
+    }
+    CHECK(result.sourceSide[source] && !result.sourceSide[sink]);
+    long long cut = 0;
+    for (const auto& edge : result.cutEdges) {
+        CHECK(result.sourceSide[edge.start] && !result.sourceSide[edge.end]);
+        cut += edge.weight;
+    }
+    CHECK(cut == result.value);
+}
+
+int main() {
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 40; round++) {
+        const size_t vertexCount = 2 + gen() % 11;
+        const auto type = round % 2 == 0 ? Graph::GraphType::Directed : Graph::GraphType::Undirected;
+        const Graph graph = randomGraph<int, long long>(vertexCount, 0.45, type, gen, uniformWeight(0LL, 19LL));
+        const size_t source = gen() % vertexCount;
+        const size_t sink = (source + 1 + gen() % (vertexCount - 1)) % vertexCount;
+        const long long expected = bruteForceMinCut(graph, source, sink);
+        for (MaxFlowAlgorithm algorithm : {MaxFlowAlgorithm::Dinic, MaxFlowAlgorithm::PushRelabel}) {
+            auto result = maxFlowByIndex(graph, source, sink, algorithm);
+            CHECK(result.has_value());
+            if (!result) continue;
+            CHECK(result->value == expected);
+            checkFlow(graph, *result, source, sink);
+        }
+    }
+
+    // Graphs too big for the brute force: both algorithms have to agree and produce a valid flow
+    for (size_t round = 0; round < 6; round++) {
+        const auto type = round % 2 == 0 ? Graph::GraphType::Directed : Graph::GraphType::Undirected;
+        const Graph graph = randomGraph<int, long long>(200, 0.05, type, gen, uniformWeight(0LL, 19LL));
+        auto dinic = maxFlowByIndex(graph, 0, 199, MaxFlowAlgorithm::Dinic);
+        auto pushRelabel = maxFlowByIndex(graph, 0, 199, MaxFlowAlgorithm::PushRelabel);
+        CHECK(dinic.has_value() && pushRelabel.has_value() && dinic->value == pushRelabel->value);
+        if (dinic) checkFlow(graph, *dinic, 0, 199);
+        if (pushRelabel) checkFlow(graph, *pushRelabel, 0, 199);
+    }
+
+    Graph line(Graph::GraphType::Directed);
+    for (int vertex : {1, 2, 3}) line.addVertex(vertex);
+    line.addEdge(1, 2, 4);
+    CHECK(maxFlow(line, 1, 3).value().value == 0);
+    CHECK(maxFlow(line, 1, 1).error() == DataStructureError::InvalidArgument);
+    CHECK(maxFlow(line, 1, 4).error() == DataStructureError::ElementNotFound);
+    line.addEdge(2, 3, -1);
+    CHECK(maxFlow(line, 1, 3).error() == DataStructureError::InvalidArgument);
+    return failures == 0 ? 0 : 1;
+}
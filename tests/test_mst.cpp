@@ -0,0 +1,71 @@
+#include <random>
+#include <vector>
+#include "graph/adjacency_matrix_graph.hpp"
+#include "check.hpp"
+
+using Graph = AdjacencyMatrixGraph<size_t, long long>;
+
+// A random spanning tree first, so the graph is connected, then extra edges; a small weight range leaves many ties
+Graph connectedGraph(size_t vertexCount, size_t extraEdges, long long maxWeight, std::mt19937_64& gen) {
+    Graph graph(Graph::GraphType::Undirected);
+    for (size_t i = 0; i < vertexCount; i++) graph.addVertex(i);
+    auto weight = [&] { return std::uniform_int_distribution<long long>(1, maxWeight)(gen); };
+    for (size_t i = 1; i < vertexCount; i++) graph.addEdgeByIndex(gen() % i, i, weight());
+    for (size_t k = 0; k < extraEdges; k++) {
+        const size_t u = gen() % vertexCount;
+        const size_t v = gen() % vertexCount;
+        if (u != v && !graph.hasEdgeByIndex(u, v)) graph.addEdgeByIndex(u, v, weight());
+    }
+    return graph;
+}
+
+long long kruskalWeight(const Graph& graph) {
+    const Graph::Graph mst = graph.kruskalMST().value();
+    long long total = 0;
+    for (size_t i = 0; i < mst.vertices.size(); i++) {
+        for (size_t j = i + 1; j < mst.vertices.size(); j++) if (mst.edges.hasEdge(i, j)) total += mst.edges.weight(i, j);
+    }
+    return total;
+}
+
+// V - 1 edges of the graph, with their real weights, that join every vertex into one tree
+void checkSpanningTree(const Graph& graph, const std::vector<Graph::Edge>& forest, long long expectedWeight) {
+    const size_t vertexCount = graph.getVertexCount().value();
+    CHECK(forest.size() + 1 == vertexCount);
+    DenseUnionFindSet components(vertexCount);
+    long long total = 0;
+    for (const auto& edge : forest) {
+        CHECK(graph.hasEdgeByIndex(edge.start, edge.end));
+        CHECK(graph.getEdgeByIndex(edge.start, edge.end) == edge.weight);
+        CHECK(components.unite(edge.start, edge.end));
+        total += edge.weight;
+    }
+    CHECK(total == expectedWeight);
+}
+
+int main() {
+    ThreadPool pool(4);
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 16; round++) {
+        const size_t vertexCount = 2 + gen() % 400;
+        const Graph graph = connectedGraph(vertexCount, vertexCount * (round % 4 == 0 ? 1 : 12), round % 2 == 0 ? 5 : 1000000, gen);
+        const long long expected = kruskalWeight(graph);
+        auto boruvka = graph.boruvkaMST(pool);
+        auto filterKruskal = graph.filterKruskalMST(pool);
+        CHECK(boruvka.has_value() && filterKruskal.has_value());
+        if (boruvka) checkSpanningTree(graph, *boruvka, expected);
+        if (filterKruskal) checkSpanningTree(graph, *filterKruskal, expected);
+    }
+
+    Graph split(Graph::GraphType::Undirected);
+    for (size_t i = 0; i < 4; i++) split.addVertex(i);
+    split.addEdgeByIndex(0, 1, 3);
+    split.addEdgeByIndex(2, 3, 4);
+    CHECK(split.boruvkaMST(pool).error() == DataStructureError::InvalidOperation);
+    CHECK(split.filterKruskalMST(pool).error() == DataStructureError::InvalidOperation);
+    Graph directed(Graph::GraphType::Directed);
+    directed.addVertex(0);
+    CHECK(directed.boruvkaMST(pool).error() == DataStructureError::InvalidOperation);
+    CHECK(directed.filterKruskalMST(pool).error() == DataStructureError::InvalidOperation);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+#include <random>
+#include <vector>
+#include "graph/adjacency_matrix_graph.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Graph = AdjacencyMatrixGraph<size_t, int>;
+
+// Hop distances read off the sequential BFS order: every vertex is one hop further than its first discovered neighbour
+std::vector<size_t> hopDistances(const Graph& graph, size_t source) {
+    const size_t vertexCount = graph.getVertexCount().value();
+    std::vector<size_t> distances(vertexCount, std::numeric_limits<size_t>::max());
+    distances[source] = 0;
+    const std::vector<size_t> order = graph.BFSByIndex(source).value();
+    for (size_t vertex : order) {
+        for (size_t next = 0; next < vertexCount; next++) {
+            if (graph.hasEdgeByIndex(vertex, next) && distances[next] == std::numeric_limits<size_t>::max()) distances[next] = distances[vertex] + 1;
+        }
+    }
+    return distances;
+}
+
+int main() {
+    ThreadPool pool(4);
+    std::mt19937_64 gen(1);
+    // Sparse rounds stay top-down; dense ones push the frontier past the bottom-up switching threshold
+    for (size_t round = 0; round < 24; round++) {
+        const size_t vertexCount = 1 + gen() % 300;
+        const double degree = round % 3 == 0 ? 1.5 : round % 3 == 1 ? 6.0 : 60.0;
+        const auto type = round % 2 == 0 ? Graph::GraphType::Directed : Graph::GraphType::Undirected;
+        const Graph graph = randomGraph<size_t, int>(vertexCount, std::min(1.0, degree / static_cast<double>(vertexCount)), type, gen, uniformWeight(1, 1));
+        const size_t source = gen() % vertexCount;
+        const std::vector<size_t> expected = graph.BFSByIndex(source).value();
+        CHECK(graph.BFSByIndex(source, pool) == expected);
+        std::vector<bool> reached(vertexCount, false);
+        for (size_t vertex : expected) reached[vertex] = true;
+        const size_t target = gen() % vertexCount;
+        CHECK(graph.hasPath(source, target, pool) == reached[target]);
+        std::vector<size_t> sources;
+        for (size_t k = 0; k < 5; k++) sources.push_back(gen() % vertexCount);
+        const std::vector<std::vector<size_t>> distances = graph.multiSourceBFSByIndex(sources, pool).value();
+        for (size_t k = 0; k < sources.size(); k++) CHECK(distances[k] == hopDistances(graph, sources[k]));
+    }
+
+    // More sources than one 512-source batch holds, with repeats inside a batch and across the batch boundary
+    const size_t batch = 512;
+    for (auto type : {Graph::GraphType::Directed, Graph::GraphType::Undirected}) {
+        const size_t vertexCount = 150;
+        const Graph graph = randomGraph<size_t, int>(vertexCount, 2.0 / static_cast<double>(vertexCount), type, gen, uniformWeight(1, 1));
+        std::vector<size_t> sources;
+        for (size_t k = 0; k < 3 * batch + 7; k++) sources.push_back(gen() % vertexCount);
+        sources[batch] = sources[batch - 1];
+        sources[1] = sources[0];
+        const std::vector<std::vector<size_t>> distances = graph.multiSourceBFSByIndex(sources, pool).value();
+        CHECK(distances.size() == sources.size());
+        std::vector<std::vector<size_t>> expected(vertexCount);
+        bool matches = true;
+        for (size_t k = 0; k < sources.size(); k++) {
+            if (expected[sources[k]].empty()) expected[sources[k]] = hopDistances(graph, sources[k]);
+            matches &= distances[k] == expected[sources[k]];
+        }
+        CHECK(matches);
+    }
+
+    const Graph single = randomGraph<size_t, int>(3, 0.0, Graph::GraphType::Directed, gen, uniformWeight(1, 1));
+    CHECK(single.BFSByIndex(3, pool).error() == DataStructureError::IndexOutOfRange);
+    CHECK(single.multiSourceBFSByIndex({0, 3}, pool).error() == DataStructureError::IndexOutOfRange);
+    CHECK(single.multiSourceBFSByIndex({}, pool).value().empty());
+    CHECK(Graph(Graph::GraphType::Directed).BFSByIndex(0, pool).error() == DataStructureError::ContainerIsEmpty);
+    return failures == 0 ? 0 : 1;
+}
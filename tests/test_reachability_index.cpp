@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "graph/adjacency_matrix_graph.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Graph = AdjacencyMatrixGraph<int, int>;
+
+// BFS from every source over the live edges
+std::vector<std::vector<bool>> bfsReachability(const Graph& graph) {
+    const size_t vertexCount = graph.getGraph().vertices.size();
+    std::vector<std::vector<bool>> reach(vertexCount, std::vector<bool>(vertexCount, false));
+    for (size_t source = 0; source < vertexCount; source++) {
+        std::vector<size_t> queue{source};
+        reach[source][source] = true;
+        for (size_t head = 0; head < queue.size(); head++) {
+            for (size_t next = 0; next < vertexCount; next++) {
+                if (reach[source][next] || !graph.hasEdgeByIndex(queue[head], next)) continue;
+                reach[source][next] = true;
+                queue.push_back(next);
+            }
+        }
+    }
+    return reach;
+}
+
+// The index (when valid) and hasPathByIndex (index or fallback BFS) both have to agree with the oracle on every pair
+void checkReachability(const Graph& graph) {
+    const auto reach = bfsReachability(graph);
+    bool indexMatches = true;
+    bool pathMatches = true;
+    for (size_t u = 0; u < reach.size(); u++) {
+        for (size_t v = 0; v < reach.size(); v++) {
+            if (graph.isReachabilityIndexValid()) indexMatches &= graph.reachesByIndex(u, v) == reach[u][v];
+            pathMatches &= graph.hasPathByIndex(u, v).value() == reach[u][v];
+        }
+    }
+    CHECK(indexMatches);
+    CHECK(pathMatches);
+}
+
+int main() {
+    ThreadPool pool(4);
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 16; round++) {
+        // Sizes on both sides of a 64-bit row word
+        const size_t vertexCount = 1 + gen() % 150;
+        const auto type = round % 2 == 0 ? Graph::GraphType::Directed : Graph::GraphType::Undirected;
+        Graph graph = randomGraph<int, int>(vertexCount, 1.2 / static_cast<double>(vertexCount), type, gen, uniformWeight(1, 9));
+        CHECK(!graph.isReachabilityIndexValid());
+        CHECK(round % 4 < 2 ? graph.buildReachabilityIndex(pool).has_value() : graph.buildReachabilityIndex().has_value());
+        CHECK(graph.isReachabilityIndexValid());
+        checkReachability(graph);
+
+        int nextValue = static_cast<int>(vertexCount);
+        for (size_t step = 0; step < 12; step++) {
+            const size_t count = graph.getGraph().vertices.size();
+            const size_t u = gen() % count;
+            const size_t v = gen() % count;
+            switch (step % 4) {
+                case 0:
+                    graph.removeEdgeByIndex(u, v);
+                    CHECK(graph.addEdgeByIndex(u, v, 1).has_value());
+                    break;
+                case 1: {
+                    // Prefer an existing edge so the removal can actually cut paths
+                    std::vector<std::pair<size_t, size_t>> edges;
+                    for (size_t i = 0; i < count; i++) for (size_t j = 0; j < count; j++) if (graph.hasEdgeByIndex(i, j)) edges.push_back({i, j});
+                    const auto [start, end] = edges.empty() ? std::pair<size_t, size_t>{u, v} : edges[gen() % edges.size()];
+                    CHECK(graph.removeEdgeByIndex(start, end).has_value());
+                    break;
+                }
+                case 2:
+                    graph.addVertex(nextValue++);
+                    break;
+                default: {
+                    std::vector<size_t> order(count);
+                    for (size_t i = 0; i < count; i++) order[i] = i;
+                    std::shuffle(order.begin(), order.end(), gen);
+                    CHECK(graph.permuteVertices(order).has_value());
+                }
+            }
+            CHECK(!graph.isReachabilityIndexValid());
+            checkReachability(graph);
+            CHECK(graph.buildReachabilityIndex(pool).has_value());
+            checkReachability(graph);
+        }
+        if (graph.getGraph().vertices.size() > 1) {
+            CHECK(graph.removeVertex(graph.getVertex(0).value()).has_value());
+            CHECK(!graph.isReachabilityIndexValid());
+            checkReachability(graph);
+        }
+        graph.clear();
+        CHECK(!graph.isReachabilityIndexValid());
+        CHECK(graph.buildReachabilityIndex().error() == DataStructureError::ContainerIsEmpty);
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "graph/adjacency_matrix_graph.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Graph = AdjacencyMatrixGraph<int, int>;
+using Ordering = Graph::VertexOrdering;
+
+// Vertex i of the reordered graph is vertex previousIndex[i] of the original: same value, same edges, same distances
+void checkRelabelling(const Graph& original, const Graph& reordered, const std::vector<size_t>& previousIndex) {
+    const size_t vertexCount = original.getVertexCount().value();
+    CHECK(previousIndex.size() == vertexCount);
+    std::vector<size_t> sorted = previousIndex;
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < sorted.size(); i++) CHECK(sorted[i] == i);
+    CHECK(reordered.getEdgeCount() == original.getEdgeCount());
+    for (size_t i = 0; i < vertexCount; i++) {
+        CHECK(reordered.getVertex(i) == original.getVertex(previousIndex[i]));
+        CHECK(reordered.getVertexIndex(reordered.getVertex(i).value()) == i);
+        for (size_t j = 0; j < vertexCount; j++) {
+            CHECK(reordered.hasEdgeByIndex(i, j) == original.hasEdgeByIndex(previousIndex[i], previousIndex[j]));
+            if (reordered.hasEdgeByIndex(i, j)) CHECK(reordered.getEdgeByIndex(i, j) == original.getEdgeByIndex(previousIndex[i], previousIndex[j]));
+        }
+    }
+    const auto before = original.floyd().value();
+    const auto after = reordered.floyd().value();
+    bool same = true;
+    for (size_t i = 0; i < vertexCount; i++) {
+        for (size_t j = 0; j < vertexCount; j++) same &= after[i][j] == before[previousIndex[i]][previousIndex[j]];
+    }
+    CHECK(same);
+}
+
+int main() {
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 12; round++) {
+        const size_t vertexCount = 1 + gen() % 90;
+        const auto type = round % 2 == 0 ? Graph::GraphType::Directed : Graph::GraphType::Undirected;
+        const Graph original = randomGraph<int, int>(vertexCount, 2.0 / static_cast<double>(vertexCount), type, gen, uniformWeight(1, 50), [](size_t i) { return static_cast<int>(i) * 11; });
+        for (Ordering ordering : {Ordering::ReverseCuthillMcKee, Ordering::DegreeDescending, Ordering::BreadthFirst}) {
+            Graph reordered = original;
+            auto reordering = reordered.reorderVertices(ordering);
+            CHECK(reordering.has_value());
+            if (reordering) checkRelabelling(original, reordered, reordering->previousIndex);
+        }
+    }
+
+    // Reverse Cuthill-McKee on a grid whose labels were shuffled brings every edge back near the diagonal
+    const size_t side = 14;
+    std::vector<size_t> label(side * side);
+    std::iota(label.begin(), label.end(), 0);
+    std::shuffle(label.begin(), label.end(), gen);
+    Graph grid(Graph::GraphType::Undirected);
+    for (size_t i = 0; i < side * side; i++) grid.addVertex(static_cast<int>(i));
+    for (size_t r = 0; r < side; r++) {
+        for (size_t c = 0; c < side; c++) {
+            if (c + 1 < side) grid.addEdgeByIndex(label[r * side + c], label[r * side + c + 1], 1);
+            if (r + 1 < side) grid.addEdgeByIndex(label[r * side + c], label[(r + 1) * side + c], 1);
+        }
+    }
+    const Graph shuffled = grid;
+    const auto reordering = grid.reorderVertices(Ordering::ReverseCuthillMcKee).value();
+    CHECK(reordering.after.bandwidth <= side + 1 && reordering.after.bandwidth < reordering.before.bandwidth);
+    checkRelabelling(shuffled, grid, reordering.previousIndex);
+
+    // A maintained topological order is carried over to the new numbering
+    Graph dag = randomGraph<int, int>(40, 0.0, Graph::GraphType::Directed, gen, uniformWeight(1, 1), [](size_t i) { return static_cast<int>(i) * 11; });
+    CHECK(dag.enableTopologicalOrder().has_value());
+    for (size_t k = 0; k < 120; k++) {
+        const size_t u = gen() % 40;
+        const size_t v = gen() % 40;
+        if (u < v && !dag.hasEdgeByIndex(u, v)) dag.addEdgeByIndex(u, v, 1);
+    }
+    CHECK(dag.reorderVertices(Ordering::DegreeDescending).has_value());
+    const std::vector<size_t> order = dag.topologicalSortByIndex().value();
+    std::vector<size_t> position(order.size());
+    for (size_t i = 0; i < order.size(); i++) position[order[i]] = i;
+    std::vector<std::pair<int, int>> edges;
+    for (size_t u = 0; u < 40; u++) {
+        for (size_t v = 0; v < 40; v++) {
+            if (!dag.hasEdgeByIndex(u, v)) continue;
+            CHECK(position[u] < position[v]);
+            edges.push_back({dag.getVertex(u).value(), dag.getVertex(v).value()});
+        }
+    }
+    CHECK(!edges.empty() && dag.addEdge(edges[0].second, edges[0].first, 1).error() == DataStructureError::CycleDetected);
+
+    CHECK(dag.permuteVertices({0, 0}).error() == DataStructureError::InvalidArgument);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+#include <random>
+#include <vector>
+#include "graph/adjacency_matrix_graph.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Graph = AdjacencyMatrixGraph<int, long long>;
+using Mode = Graph::PathSearchMode;
+
+// The reported path has to start and end at the right vertices and its edges must add up to the reported distance
+void checkPath(const Graph& graph, const Graph::ShortestPath& result, int source, int target) {
+    CHECK(!result.path.empty() && result.path.front() == source && result.path.back() == target);
+    long long length = 0;
+    for (size_t i = 1; i < result.path.size(); i++) {
+        auto weight = graph.getEdge(result.path[i - 1], result.path[i]);
+        CHECK(weight.has_value());
+        if (weight) length += *weight;
+    }
+    CHECK(length == result.distance);
+}
+
+void compareWithDijkstra(const Graph& graph, size_t sourceIndex) {
+    const std::vector<long long> distances = graph.DijkstraByIndex(sourceIndex).value();
+    const int source = graph.getVertex(sourceIndex).value();
+    const bool undirected = graph.getGraph().graphType == Graph::GraphType::Undirected;
+    for (size_t targetIndex = 0; targetIndex < distances.size(); targetIndex++) {
+        const int target = graph.getVertex(targetIndex).value();
+        // In an undirected graph the exact distance to target is a consistent heuristic; elsewhere zero is
+        std::vector<long long> remaining(distances.size(), 0);
+        if (undirected) remaining = graph.DijkstraByIndex(targetIndex).value();
+        auto heuristic = [&](int vertex) {
+            const long long distance = remaining[graph.getVertexIndex(vertex).value()];
+            return distance == std::numeric_limits<long long>::max() ? 0 : distance;
+        };
+        for (Mode mode : {Mode::Dijkstra, Mode::Bidirectional, Mode::AStar}) {
+            auto result = graph.shortestPath(source, target, mode, heuristic);
+            if (distances[targetIndex] == std::numeric_limits<long long>::max()) {
+                CHECK(result.error() == DataStructureError::ElementNotFound);
+                continue;
+            }
+            CHECK(result.has_value());
+            if (!result) continue;
+            CHECK(result->distance == distances[targetIndex]);
+            checkPath(graph, *result, source, target);
+        }
+    }
+}
+
+int main() {
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 30; round++) {
+        const size_t vertexCount = 1 + gen() % 60;
+        const auto type = round % 2 == 0 ? Graph::GraphType::Directed : Graph::GraphType::Undirected;
+        const Graph graph = randomGraph<int, long long>(vertexCount, 2.5 / static_cast<double>(vertexCount), type, gen, uniformWeight(0LL, 999LL), [](size_t i) { return static_cast<int>(i) * 5; });
+        compareWithDijkstra(graph, gen() % vertexCount);
+    }
+
+    Graph line(Graph::GraphType::Undirected);
+    for (int vertex : {1, 2, 3}) line.addVertex(vertex);
+    line.addEdge(1, 2, 4);
+    line.addEdge(2, 3, 6);
+    CHECK(line.Dijkstra(3) == std::vector<long long>{10, 6, 0});
+    CHECK(line.shortestPath(1, 3, Mode::AStar).error() == DataStructureError::InvalidArgument);
+    CHECK(line.shortestPath(1, 4).error() == DataStructureError::ElementNotFound);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <limits>
+#include "graph/csr_graph.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Matrix = AdjacencyMatrixGraph<int, int>;
+using CSR = CSRGraph<int, int>;
+
+// reach[u][v]: v is reachable from u, by one BFS per source over the live edges
+std::vector<std::vector<bool>> transitiveClosure(const Matrix& graph) {
+    const size_t vertexCount = graph.getGraph().vertices.size();
+    std::vector<std::vector<bool>> reach(vertexCount, std::vector<bool>(vertexCount, false));
+    for (size_t source = 0; source < vertexCount; source++) {
+        std::vector<size_t> queue{source};
+        reach[source][source] = true;
+        for (size_t head = 0; head < queue.size(); head++) {
+            for (size_t next = 0; next < vertexCount; next++) {
+                if (reach[source][next] || !graph.hasEdgeByIndex(queue[head], next)) continue;
+                reach[source][next] = true;
+                queue.push_back(next);
+            }
+        }
+    }
+    return reach;
+}
+
+void checkComponents(const Matrix& graph) {
+    const size_t vertexCount = graph.getGraph().vertices.size();
+    const std::vector<size_t> components = graph.stronglyConnectedComponents().value();
+    const auto reach = transitiveClosure(graph);
+    size_t componentCount = 0;
+    for (size_t component : components) componentCount = std::max(componentCount, component + 1);
+    std::vector<bool> used(componentCount, false);
+    for (size_t component : components) used[component] = true;
+    CHECK(std::find(used.begin(), used.end(), false) == used.end());
+    bool sameClasses = true;
+    bool forward = true;
+    for (size_t u = 0; u < vertexCount; u++) {
+        for (size_t v = 0; v < vertexCount; v++) {
+            sameClasses &= (components[u] == components[v]) == (reach[u][v] && reach[v][u]);
+            if (graph.hasEdgeByIndex(u, v)) forward &= components[u] <= components[v];
+        }
+    }
+    CHECK(sameClasses);
+    CHECK(forward);
+
+    // Condensation arcs: the lightest edge between each ordered pair of distinct components
+    std::vector<std::vector<int>> lightest(componentCount, std::vector<int>(componentCount, std::numeric_limits<int>::max()));
+    for (size_t u = 0; u < vertexCount; u++) {
+        for (size_t v = 0; v < vertexCount; v++) {
+            if (components[u] == components[v] || !graph.hasEdgeByIndex(u, v)) continue;
+            lightest[components[u]][components[v]] = std::min(lightest[components[u]][components[v]], graph.getEdgeByIndex(u, v).value());
+        }
+    }
+    const CSR csr(graph);
+    CHECK(csr.stronglyConnectedComponents().value() == components);
+    const auto dag = graph.condensation().value();
+    const auto csrDag = csr.condensation().value();
+    CHECK(dag.getVertexCount().value() == componentCount);
+    CHECK(csrDag.getVertexCount().value() == componentCount);
+    bool arcsMatch = true;
+    bool ascending = true;
+    for (size_t a = 0; a < componentCount; a++) {
+        CHECK(dag.getVertex(a).value() == a);
+        for (size_t b = 0; b < componentCount; b++) {
+            const bool expected = lightest[a][b] != std::numeric_limits<int>::max();
+            arcsMatch &= dag.hasEdgeByIndex(a, b) == expected && csrDag.hasEdge(a, b) == expected;
+            if (expected) arcsMatch &= dag.getEdgeByIndex(a, b).value() == lightest[a][b] && csrDag.getEdge(a, b).value() == lightest[a][b];
+            if (expected) ascending &= a < b;
+        }
+    }
+    CHECK(arcsMatch);
+    // Arcs only go from lower to higher ids, so the condensation is acyclic and its ids are a topological order
+    CHECK(ascending);
+    CHECK(dag.hasCycle().value() == false);
+}
+
+int main() {
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 40; round++) {
+        const size_t vertexCount = 1 + gen() % 50;
+        // From mostly singleton components up to one giant one
+        const double degree = 0.5 + static_cast<double>(round % 5);
+        const Matrix graph = randomGraph<int, int>(vertexCount, degree / static_cast<double>(vertexCount), Matrix::GraphType::Directed, gen, uniformWeight(1, 99), [](size_t i) { return static_cast<int>(i) * 7; });
+        checkComponents(graph);
+    }
+
+    // Undirected graphs get their connected components; a condensation is only defined for directed ones
+    const Matrix undirected = randomGraph<int, int>(30, 0.05, Matrix::GraphType::Undirected, gen, uniformWeight(1, 9));
+    const std::vector<size_t> components = undirected.stronglyConnectedComponents().value();
+    const auto reach = transitiveClosure(undirected);
+    bool sameClasses = true;
+    for (size_t u = 0; u < 30; u++) for (size_t v = 0; v < 30; v++) sameClasses &= (components[u] == components[v]) == reach[u][v];
+    CHECK(sameClasses);
+    CHECK(CSR(undirected).stronglyConnectedComponents().value() == components);
+    CHECK(undirected.condensation().error() == DataStructureError::InvalidOperation);
+    CHECK(CSR(undirected).condensation().error() == DataStructureError::InvalidOperation);
+    CHECK(Matrix(Matrix::GraphType::Directed).stronglyConnectedComponents().error() == DataStructureError::ContainerIsEmpty);
+    return failures == 0 ? 0 : 1;
+}
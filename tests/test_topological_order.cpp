@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "graph/adjacency_matrix_graph.hpp"
+#include "check.hpp"
+#include "graph_fixtures.hpp"
+
+using Graph = AdjacencyMatrixGraph<int, int>;
+
+// BFS over the live edges, independent of the maintained order
+bool reaches(const Graph& graph, size_t from, size_t to) {
+    const size_t vertexCount = graph.getGraph().vertices.size();
+    std::vector<bool> seen(vertexCount, false);
+    std::vector<size_t> queue{from};
+    seen[from] = true;
+    for (size_t head = 0; head < queue.size(); head++) {
+        if (queue[head] == to) return true;
+        for (size_t next = 0; next < vertexCount; next++) {
+            if (seen[next] || !graph.hasEdgeByIndex(queue[head], next)) continue;
+            seen[next] = true;
+            queue.push_back(next);
+        }
+    }
+    return false;
+}
+
+// The maintained order is a permutation of the vertices and every edge points forward in it
+bool isTopologicalOrder(const Graph& graph) {
+    const size_t vertexCount = graph.getGraph().vertices.size();
+    const std::vector<size_t> order = graph.topologicalSortByIndex().value();
+    if (order.size() != vertexCount) return false;
+    std::vector<size_t> position(vertexCount, vertexCount);
+    for (size_t p = 0; p < vertexCount; p++) {
+        if (order[p] >= vertexCount || position[order[p]] != vertexCount) return false;
+        position[order[p]] = p;
+    }
+    for (size_t u = 0; u < vertexCount; u++) {
+        for (size_t v = 0; v < vertexCount; v++) if (graph.hasEdgeByIndex(u, v) && position[u] >= position[v]) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::mt19937_64 gen(1);
+    for (size_t round = 0; round < 10; round++) {
+        const size_t vertexCount = 5 + gen() % 40;
+        Graph graph = randomGraph<int, int>(vertexCount, 1.0 / static_cast<double>(vertexCount), Graph::GraphType::Directed, gen, uniformWeight(1, 9), nullptr, true);
+        // Random DAG labels are in index order, so shuffle the indices before the order starts being maintained
+        std::vector<size_t> shuffled(vertexCount);
+        for (size_t i = 0; i < vertexCount; i++) shuffled[i] = i;
+        std::shuffle(shuffled.begin(), shuffled.end(), gen);
+        CHECK(graph.permuteVertices(shuffled).has_value());
+        CHECK(graph.enableTopologicalOrder().has_value());
+        int nextValue = static_cast<int>(vertexCount);
+        size_t rejected = 0;
+        for (size_t step = 0; step < 300; step++) {
+            const size_t count = graph.getGraph().vertices.size();
+            const size_t roll = gen() % 100;
+            if (roll < 75) {
+                const size_t u = gen() % count;
+                const size_t v = gen() % count;
+                if (graph.hasEdgeByIndex(u, v)) continue;
+                const std::vector<size_t> before = graph.topologicalSortByIndex().value();
+                const size_t edgesBefore = graph.getEdgeCount().value();
+                if (u == v || reaches(graph, v, u)) {
+                    rejected++;
+                    CHECK(graph.addEdgeByIndex(u, v, 1).error() == DataStructureError::CycleDetected);
+                    CHECK(!graph.hasEdgeByIndex(u, v));
+                    CHECK(graph.getEdgeCount().value() == edgesBefore);
+                    CHECK(graph.topologicalSortByIndex().value() == before);
+                }
+                else CHECK(graph.addEdgeByIndex(u, v, 1).has_value());
+            }
+            else if (roll < 85) {
+                const size_t u = gen() % count;
+                const size_t v = gen() % count;
+                CHECK(graph.removeEdgeByIndex(u, v).has_value());
+            }
+            else if (roll < 93 && count > 2) CHECK(graph.removeVertex(graph.getVertex(gen() % count).value()).has_value());
+            else if (roll < 97) graph.addVertex(nextValue++);
+            else {
+                std::vector<size_t> order(count);
+                for (size_t i = 0; i < count; i++) order[i] = i;
+                std::shuffle(order.begin(), order.end(), gen);
+                CHECK(graph.permuteVertices(order).has_value());
+            }
+            CHECK(isTopologicalOrder(graph));
+            CHECK(graph.hasCycle().value() == false);
+        }
+        CHECK(rejected > size_t{0});
+    }
+
+    // Each edge of a chain closes a cycle when reversed, and the last vertex of the chain still comes last after a removal
+    Graph chain(Graph::GraphType::Directed);
+    for (int vertex = 0; vertex < 5; vertex++) chain.addVertex(vertex);
+    CHECK(chain.enableTopologicalOrder().has_value());
+    for (int vertex = 4; vertex > 0; vertex--) CHECK(chain.addEdge(vertex - 1, vertex, 1).has_value());
+    for (int vertex = 1; vertex < 5; vertex++) CHECK(chain.addEdge(vertex, 0, 1).error() == DataStructureError::CycleDetected);
+    CHECK(chain.addEdge(2, 2, 1).error() == DataStructureError::CycleDetected);
+    CHECK(chain.removeVertex(2).has_value());
+    CHECK(chain.addEdge(3, 0, 1).has_value());
+    CHECK(isTopologicalOrder(chain));
+
+    Graph cyclic(Graph::GraphType::Directed);
+    for (int vertex = 0; vertex < 2; vertex++) cyclic.addVertex(vertex);
+    cyclic.addEdge(0, 1, 1);
+    cyclic.addEdge(1, 0, 1);
+    CHECK(cyclic.enableTopologicalOrder().error() == DataStructureError::CycleDetected);
+    CHECK(Graph(Graph::GraphType::Undirected).enableTopologicalOrder().error() == DataStructureError::InvalidOperation);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+#include <random>
+#include <string>
+#include <vector>
+#include "set/union_find_set.hpp"
+#include "check.hpp"
+
+int main() {
+    std::mt19937_64 gen(1);
+
+    // The batch overloads against the single-element calls on a twin set fed the same operations
+    for (size_t round = 0; round < 20; round++) {
+        const size_t size = 1 + gen() % 300;
+        std::vector<int> values(size);
+        for (size_t i = 0; i < size; i++) values[i] = static_cast<int>(i) * 3 - 100;
+        UnionFindSet<int> batch(values);
+        UnionFindSet<int> single(values);
+        for (size_t phase = 0; phase < 4; phase++) {
+            std::vector<std::pair<int, int>> pairs;
+            for (size_t k = 0; k < size / 2 + gen() % 20; k++) pairs.push_back({values[gen() % size], values[gen() % size]});
+            if (!pairs.empty()) pairs.push_back(pairs.front());
+            size_t merged = 0;
+            for (const auto& [first, second] : pairs) {
+                merged += single.find(first).value() != single.find(second).value();
+                CHECK(single.unionSet(first, second).has_value());
+            }
+            CHECK(batch.unionSet(std::span<const std::pair<int, int>>(pairs)).value() == merged);
+
+            std::vector<int> queries;
+            for (size_t k = 0; k < size; k++) queries.push_back(values[gen() % size]);
+            queries.push_back(queries.front());
+            const std::vector<int> roots = batch.find(std::span<const int>(queries)).value();
+            CHECK(roots.size() == queries.size());
+            bool same = true;
+            for (size_t k = 0; k < queries.size(); k++) same &= roots[k] == single.find(queries[k]).value();
+            CHECK(same);
+
+            // Every value is 2 mod 3, so 0 and 1 are unknown; one of them anywhere fails the whole batch before anything is compressed or united
+            const std::vector<size_t> parentBefore = batch.parent;
+            std::vector<int> withUnknown = queries;
+            withUnknown.push_back(0);
+            CHECK(batch.find(std::span<const int>(withUnknown)).error() == DataStructureError::ElementNotFound);
+            std::vector<std::pair<int, int>> pairsWithUnknown = pairs;
+            pairsWithUnknown.push_back({values[0], 1});
+            CHECK(batch.unionSet(std::span<const std::pair<int, int>>(pairsWithUnknown)).error() == DataStructureError::ElementNotFound);
+            CHECK(batch.parent == parentBefore);
+        }
+    }
+
+    UnionFindSet<std::string> names({"a", "b", "c", "d"});
+    const std::vector<std::pair<std::string, std::string>> namePairs{{"a", "b"}, {"b", "a"}, {"c", "d"}};
+    CHECK(names.unionSet(std::span<const std::pair<std::string, std::string>>(namePairs)).value() == size_t{2});
+    CHECK(names.isConnected("a", "b").has_value());
+    CHECK(names.isConnected("a", "c").error() == DataStructureError::InvalidOperation);
+    CHECK(names.indexOf("e").error() == DataStructureError::ElementNotFound);
+    CHECK(names.find(std::span<const std::string>()).value().empty());
+
+    for (size_t round = 0; round < 20; round++) {
+        const size_t size = 1 + gen() % 500;
+        DenseUnionFindSet batch(size);
+        DenseUnionFindSet single(size);
+        std::vector<std::pair<size_t, size_t>> pairs;
+        for (size_t k = 0; k < size + gen() % 50; k++) pairs.push_back({gen() % size, gen() % size});
+        pairs.push_back(pairs.front());
+        std::vector<uint8_t> merged(pairs.size(), 2);
+        size_t merges = 0;
+        bool flagsMatch = true;
+        const size_t batchMerges = batch.unite(pairs, merged);
+        for (size_t k = 0; k < pairs.size(); k++) {
+            const bool joined = single.unite(pairs[k].first, pairs[k].second);
+            flagsMatch &= merged[k] == joined;
+            merges += joined;
+        }
+        CHECK(flagsMatch);
+        CHECK(batchMerges == merges);
+        CHECK(batch.getSetCount() == single.getSetCount() && batch.getSetCount() == size - merges);
+
+        std::vector<size_t> queries;
+        for (size_t k = 0; k < 2 * size; k++) queries.push_back(gen() % size);
+        std::vector<size_t> roots(queries.size());
+        batch.find(queries, roots);
+        bool same = true;
+        for (size_t k = 0; k < queries.size(); k++) same &= roots[k] == single.find(queries[k]) && batch.setSize(queries[k]) == single.setSize(queries[k]);
+        CHECK(same);
+        // Without the merged span only the count comes back
+        DenseUnionFindSet counted(size);
+        CHECK(counted.unite(pairs) == merges);
+    }
+    return failures == 0 ? 0 : 1;
+}